@@ -0,0 +1,162 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Dynamic Resolution
+*
+*	This example draws a heavy 3D scene in four viewports, each in its own window
+*	With dynamic resolution on, the views lower their resolution when the frame time goes over the target,
+*	and are still shown at the full size of their window. Raise the load to see the scale drop.
+*	Every view shows its scale, the size it is drawn at and its frame times.
+*	VSync is off so the frame time shows the real cost of a frame.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <cmath>
+
+static constexpr int ViewCount = 4;
+
+struct SceneView
+{
+	rlImGuiViewport* Viewport = nullptr;
+	Camera3D Camera = { 0 };
+	const char* Name = nullptr;
+};
+
+static void DrawScene(int load, float time)
+{
+	DrawPlane(Vector3{ 0, 0, 0 }, Vector2{ 60, 60 }, BEIGE);
+
+	// a square of spinning towers, the load sets how many there are on each side
+	float spacing = 50.0f / load;
+	for (int x = 0; x < load; x++)
+	{
+		for (int z = 0; z < load; z++)
+		{
+			Vector3 position = { -25 + x * spacing, 0, -25 + z * spacing };
+			float height = 1 + 0.5f * sinf(time + x * 0.3f + z * 0.2f);
+			DrawCube(Vector3{ position.x, height / 2, position.z }, spacing * 0.5f, height, spacing * 0.5f, ColorFromHSV(float((x * 7 + z * 3) % 360), 0.6f, 0.9f));
+			DrawCubeWires(Vector3{ position.x, height / 2, position.z }, spacing * 0.5f, height, spacing * 0.5f, DARKGRAY);
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - dynamic resolution");
+	rlImGuiSetup(true);
+
+	static const char* names[ViewCount] = { "Front", "Side", "Top", "Orbit" };
+	static const Vector3 positions[ViewCount] = { { 0, 10, 40 }, { 40, 10, 0 }, { 0, 60, 1 }, { 30, 25, 30 } };
+
+	SceneView views[ViewCount];
+	for (int i = 0; i < ViewCount; i++)
+	{
+		views[i].Viewport = rlImGuiCreateViewport();
+		views[i].Name = names[i];
+		views[i].Camera.position = positions[i];
+		views[i].Camera.up.y = 1;
+		views[i].Camera.fovy = 45;
+		views[i].Camera.projection = CAMERA_PERSPECTIVE;
+	}
+
+	bool dynamicResolution = true;
+	float targetMs = 8;
+	float minScale = 0.33f;
+	int load = 40;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		float time = float(GetTime());
+		views[3].Camera.position = Vector3{ cosf(time * 0.2f) * 40, 25, sinf(time * 0.2f) * 40 };
+
+		// views that were hidden last frame are not drawn
+		for (SceneView& view : views)
+		{
+			rlImGuiSetViewportDynamicResolution(view.Viewport, dynamicResolution ? targetMs : 0, minScale, 1);
+
+			if (!rlImGuiBeginViewportTexture(view.Viewport))
+				continue;
+
+			ClearBackground(SKYBLUE);
+			rlImGuiBeginViewportMode3D(view.Viewport, view.Camera);
+			DrawScene(load, time);
+			EndMode3D();
+
+			// 2D drawing uses the full pixel size, whatever the scale
+			DrawText(view.Name, 10, 10, 20, BLACK);
+			rlImGuiEndViewportTexture(view.Viewport);
+		}
+
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(300, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Settings", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			ImGui::Checkbox("Dynamic Resolution", &dynamicResolution);
+			ImGui::SliderFloat("Target ms", &targetMs, 2, 33, "%.1f");
+			ImGui::SliderFloat("Min Scale", &minScale, 0.1f, 1, "%.2f");
+			ImGui::SliderInt("Load", &load, 5, 150);
+			ImGui::Text("Frame %.2f ms", GetFrameTime() * 1000.0f);
+
+			rlImGuiRenderTexturePoolStats poolStats;
+			rlImGuiGetRenderTexturePoolStats(&poolStats);
+			ImGui::Text("View textures %d, %.1f MB", poolStats.Textures, poolStats.TextureBytes / (1024.0 * 1024.0));
+		}
+		ImGui::End();
+
+		for (int i = 0; i < ViewCount; i++)
+		{
+			SceneView& view = views[i];
+
+			ImGui::SetNextWindowPos(ImVec2(320.0f + (i % 2) * 475, 10.0f + (i / 2) * 390), ImGuiCond_Once);
+			ImGui::SetNextWindowSize(ImVec2(470, 385), ImGuiCond_Once);
+			if (ImGui::Begin(view.Name))
+			{
+				Vector2 renderSize = rlImGuiGetViewportRenderSize(view.Viewport);
+				ImGui::Text("Scale %.2f, drawn at %.0fx%.0f", rlImGuiGetViewportResolutionScale(view.Viewport), renderSize.x, renderSize.y);
+
+				int count = 0;
+				int offset = 0;
+				const float* frameTimes = rlImGuiGetViewportFrameTimes(view.Viewport, &count, &offset);
+				ImGui::PlotLines("##FrameTimes", frameTimes, count, offset, "frame ms", 0, targetMs * 2, ImVec2(ImGui::GetContentRegionAvail().x, 40));
+
+				rlImGuiViewportImage(view.Viewport, Vector2{ 0, 0 });
+			}
+			ImGui::End();
+		}
+
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	for (SceneView& view : views)
+		rlImGuiDestroyViewport(view.Viewport);
+	rlImGuiShutdown();
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
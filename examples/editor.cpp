@@ -21,6 +21,10 @@ bool Quit = false;
 
 bool ImGuiDemoOpen = false;
 
+bool LateInput = false;
+bool LateCursor = false;
+bool LatencyOverlayOpen = false;
+
 // DPI scaling functions
 float ScaleToDPIF(float value)
 {
@@ -37,8 +41,6 @@ class DocumentWindow
 public:
 	bool Open = false;
 
-	RenderTexture ViewTexture;
-
 	virtual void Setup() = 0;
 	virtual void Shutdown() = 0;
 	virtual void Show() = 0;
@@ -53,19 +55,18 @@ class ImageViewerWindow : public DocumentWindow
 {
 public:
 
+	// the view texture comes from the rlImGui pool and follows the window size
+	rlImGuiViewport* View = nullptr;
+
 	void Setup() override
 	{
 		Camera.zoom = 1;
 		Camera.target.x = 0;
 		Camera.target.y = 0;
 		Camera.rotation = 0;
-		Camera.offset.x = GetScreenWidth() / 2.0f;
-		Camera.offset.y = GetScreenHeight() / 2.0f;
 
-		ViewTexture = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
+		View = rlImGuiCreateViewport();
 		ImageTexture = LoadTexture("resources/parrots.png");
-
-		UpdateRenderTexture();
 	}
 
 	void Show() override
@@ -77,20 +78,8 @@ public:
 
 		if (ImGui::Begin("Image Viewer", &Open, ImGuiWindowFlags_NoScrollbar))
 		{
-			// save off the screen space content rectangle
-			ContentRect = { ImGui::GetWindowPos().x + ImGui::GetCursorScreenPos().x, ImGui::GetWindowPos().y + ImGui::GetCursorScreenPos().y, ImGui::GetContentRegionAvail().x, ImGui::GetContentRegionAvail().y };
-
 			Focused = ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows);
 
-			ImVec2 size = ImGui::GetContentRegionAvail();
-
-			// center the scratch pad in the view
-			Rectangle viewRect = { 0 };
-			viewRect.x = ViewTexture.texture.width / 2 - size.x / 2;
-			viewRect.y = ViewTexture.texture.height / 2 - size.y / 2;
-			viewRect.width = size.x;
-			viewRect.height = -size.y;
-
 			if (ImGui::BeginChild("Toolbar", ImVec2(ImGui::GetContentRegionAvail().x, 25)))
 			{
 				ImGui::SetCursorPosX(2);
@@ -125,7 +114,10 @@ public:
 				ImGui::EndChild();
 			}
 
-			rlImGuiImageRect(&ViewTexture.texture, int(size.x), int(size.y), viewRect);	
+			rlImGuiViewportImage(View, Vector2{ 0, 0 });
+
+			// save off the screen space content rectangle
+			ContentRect = rlImGuiGetViewportScreenRect(View);
 		}
 		ImGui::End();
 		ImGui::PopStyleVar();
@@ -136,15 +128,6 @@ public:
 		if (!Open)
 			return;
 
-		if (IsWindowResized())
-		{
-			UnloadRenderTexture(ViewTexture);
-			ViewTexture = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
-
-			Camera.offset.x = GetScreenWidth() / 2.0f;
-			Camera.offset.y = GetScreenHeight() / 2.0f;
-		}
-
 		Vector2 mousePos = GetMousePosition();
 
 		if (Focused)
@@ -167,7 +150,6 @@ public:
 					Camera.target = Vector2Add(LastTarget, mouseDelta);
 
 					DirtyScene = true;
-
 				}
 				else
 				{
@@ -180,11 +162,7 @@ public:
 			Dragging = false;
 		}
 
-		if (DirtyScene)
-		{
-			DirtyScene = false;
-			UpdateRenderTexture();
-		}
+		UpdateRenderTexture();
 	}
 
 	Texture ImageTexture;
@@ -194,7 +172,11 @@ public:
 	Vector2 LastTarget = { 0 };
 	bool Dragging = false;
 
-	bool DirtyScene = false;
+	bool DirtyScene = true;
+
+	// what the view texture held when the scene was last drawn into it
+	unsigned int DrawnTextureId = 0;
+	Vector2 DrawnSize = { 0 };
 
 	enum class ToolMode
 	{
@@ -206,7 +188,30 @@ public:
 
 	void UpdateRenderTexture()
 	{
-		BeginTextureMode(ViewTexture);
+		if (!rlImGuiBeginViewportTexture(View))
+		{
+			// a hidden view can give its texture back to the pool, so it is drawn again when it is shown
+			DrawnTextureId = 0;
+			return;
+		}
+
+		// the scene is only drawn again when it changed, or when the view got another texture or a new size
+		Vector2 viewSize = rlImGuiGetViewportPixelSize(View);
+		Vector2 renderSize = rlImGuiGetViewportRenderSize(View);
+		unsigned int textureId = rlImGuiGetViewportTexture(View)->id;
+		if (!DirtyScene && textureId == DrawnTextureId && renderSize.x == DrawnSize.x && renderSize.y == DrawnSize.y)
+		{
+			rlImGuiEndViewportTexture(View);
+			return;
+		}
+
+		DirtyScene = false;
+		DrawnTextureId = textureId;
+		DrawnSize = renderSize;
+
+		Camera.offset.x = viewSize.x / 2.0f;
+		Camera.offset.y = viewSize.y / 2.0f;
+
 		ClearBackground(BLUE);
 
 		// camera with our view offset with a world origin of 0,0
@@ -216,12 +221,12 @@ public:
 		DrawTexture(ImageTexture, ImageTexture.width / -2, ImageTexture.height / -2, WHITE);
 
 		EndMode2D();
-		EndTextureMode();
+		rlImGuiEndViewportTexture(View);
 	}
 
 	void Shutdown() override
 	{
-		UnloadRenderTexture(ViewTexture);
+		rlImGuiDestroyViewport(View);
 		UnloadTexture(ImageTexture);
 	}
 };
@@ -231,9 +236,12 @@ class SceneViewWindow : public DocumentWindow
 public:
 	Camera3D Camera = { 0 };
 
+	// the view renders at the size it is shown at, and not at all when it can't be seen
+	rlImGuiViewport* View = nullptr;
+
 	void Setup() override
 	{
-		ViewTexture = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
+		View = rlImGuiCreateViewport();
 
 		Camera.fovy = 45;
 		Camera.up.y = 1;
@@ -250,7 +258,7 @@ public:
 
 	void Shutdown() override
 	{
-		UnloadRenderTexture(ViewTexture);
+		rlImGuiDestroyViewport(View);
 		UnloadTexture(GridTexture);
 	}
 
@@ -263,7 +271,7 @@ public:
 		{
 			Focused = ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows);
 			// draw the view
-			rlImGuiImageRenderTextureFit(&ViewTexture, true);
+			rlImGuiViewportImage(View, Vector2{ 0, 0 });
 		}
 		ImGui::End();
 		ImGui::PopStyleVar();
@@ -274,21 +282,17 @@ public:
 		if (!Open)
 			return;
 
-		if (IsWindowResized())
-		{
-			UnloadRenderTexture(ViewTexture);
-			ViewTexture = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
-		}
-
 		float period = 10;
 		float magnitude = 25;
 
 		Camera.position.x = sinf(float(GetTime() / period)) * magnitude;
 
-		BeginTextureMode(ViewTexture);
+		// collapsed, in a hidden tab or scrolled away
+		if (!rlImGuiBeginViewportTexture(View))
+			return;
 		ClearBackground(SKYBLUE);
 
-		BeginMode3D(Camera);
+		rlImGuiBeginViewportMode3D(View, Camera);
 
 		// grid of cube trees on a plane to make a "world"
 		DrawPlane(Vector3{ 0, 0, 0 }, Vector2{ 50, 50 }, BEIGE); // simple world plane
@@ -310,7 +314,7 @@ public:
 		}
 
 		EndMode3D();
-		EndTextureMode();
+		rlImGuiEndViewportTexture(View);
 	}
 
 	Texture2D GridTexture = { 0 };
@@ -338,6 +342,25 @@ void DoMainMenu()
 			ImGui::MenuItem("Image Viewer", nullptr, &ImageViewer.Open);
 			ImGui::MenuItem("3D View", nullptr, &SceneView.Open);
 
+			// closed, collapsed and hidden views give their textures back to the pool
+			rlImGuiRenderTexturePoolStats poolStats;
+			rlImGuiGetRenderTexturePoolStats(&poolStats);
+			ImGui::Separator();
+			ImGui::TextDisabled("View textures %d, %.1f MB", poolStats.Textures, poolStats.TextureBytes / (1024.0 * 1024.0));
+
+			ImGui::EndMenu();
+		}
+
+		if (ImGui::BeginMenu("Input"))
+		{
+			// only builds with RLIMGUI_GLFW_EVENTS can read the mouse again
+			ImGui::MenuItem("Late Mouse Position", nullptr, &LateInput, rlImGuiCanPollInput());
+			if (ImGui::MenuItem("Late Software Cursor", nullptr, &LateCursor))
+				rlImGuiSetLateSoftwareCursor(LateCursor);
+
+			if (ImGui::MenuItem("Latency Overlay", nullptr, &LatencyOverlayOpen))
+				rlImGuiSetInputLatencyTracking(LatencyOverlayOpen);
+
 			ImGui::EndMenu();
 		}
 		ImGui::EndMainMenuBar();
@@ -374,9 +397,16 @@ int main(int argc, char* argv[])
 		BeginDrawing();
 		ClearBackground(DARKGRAY);
 
+		// read the mouse again after the update, so the UI uses the newest position
+		if (LateInput)
+			rlImGuiPollInput();
+
 		rlImGuiBegin();
 		DoMainMenu();
 
+		if (LatencyOverlayOpen)
+			rlImGuiShowInputLatencyOverlay(&LatencyOverlayOpen);
+
 		if (ImGuiDemoOpen)
 			ImGui::ShowDemoWindow(&ImGuiDemoOpen);
 
@@ -391,11 +421,11 @@ int main(int argc, char* argv[])
 		EndDrawing();
 		//----------------------------------------------------------------------------------
 	}
-	rlImGuiShutdown();
-
 	ImageViewer.Shutdown();
 	SceneView.Shutdown();
 
+	rlImGuiShutdown();
+
 	// De-Initialization
 	//--------------------------------------------------------------------------------------   
 	CloseWindow();        // Close window and OpenGL context
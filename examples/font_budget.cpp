@@ -0,0 +1,174 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Font Budget
+*
+*	This example runs a long session in a few seconds, every half second it shows the next language at a new size.
+*	Without a budget every size stays in the font atlas and the atlas keeps growing.
+*	With a budget the sizes that have not been used for a while are evicted and the atlas is repacked.
+*	Pass a font file with more scripts (such as a Noto font) to add Cyrillic, Greek and CJK pages.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+struct LocalizedText
+{
+	const char* Language;
+	const char* Text;
+	bool NeedsExtraFont;
+};
+
+static constexpr LocalizedText Languages[] =
+{
+	{ "English", "Open file, save changes, settings", false },
+	{ "Français", "Ouvrir le fichier, enregistrer les modifications, paramètres", false },
+	{ "Deutsch", "Datei öffnen, Änderungen speichern, Größe ändern", false },
+	{ "Español", "Abrir archivo, guardar cambios, configuración ¿Sí?", false },
+	{ "Dansk", "Åbn fil, gem ændringer, indstillinger", false },
+	{ "Íslenska", "Opna skrá, vista breytingar, stillingar þýðing", false },
+	{ "Русский", "Открыть файл, сохранить изменения, настройки", true },
+	{ "Ελληνικά", "Άνοιγμα αρχείου, αποθήκευση αλλαγών, ρυθμίσεις", true },
+	{ "日本語", "ファイルを開く、変更を保存、設定", true },
+	{ "中文", "打开文件，保存更改，设置", true },
+	{ "한국어", "파일 열기, 변경 사항 저장, 설정", true },
+};
+static constexpr int LanguageCount = int(sizeof(Languages) / sizeof(Languages[0]));
+
+static constexpr int HistoryCount = 120;
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	const char* extraFont = argc > 1 ? argv[1] : nullptr;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - font budget");
+	SetTargetFPS(144);
+
+	rlImGuiBeginInitImGui();
+	ImGui::StyleColorsDark();
+	if (extraFont && FileExists(extraFont))
+	{
+		ImFontConfig config;
+		config.MergeMode = true;
+		ImGui::GetIO().Fonts->AddFontFromFileTTF(extraFont, 0.0f, &config);
+	}
+	else
+	{
+		extraFont = nullptr;
+	}
+	rlImGuiEndInitImGui();
+
+	bool useBudget = true;
+	int budgetKB = 1024;
+	int coldFrames = 120;
+	rlImGuiSetFontAtlasBudget(budgetKB * 1024LL, coldFrames);
+
+	int page = 0;
+	double nextPageTime = GetTime() + 0.5;
+
+	float atlasHistory[HistoryCount] = { 0 };
+	float occupancyHistory[HistoryCount] = { 0 };
+	int historyFrame = 0;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		if (GetTime() >= nextPageTime)
+		{
+			page++;
+			nextPageTime = GetTime() + 0.5;
+		}
+
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		// the page shows one language at a size that changes every page, so the old sizes go cold
+		const LocalizedText& text = Languages[page % LanguageCount];
+		float size = 12.0f + (page % 60);
+		if (!text.NeedsExtraFont || extraFont)
+		{
+			ImGui::SetNextWindowPos(ImVec2(400, 20), ImGuiCond_Once);
+			ImGui::SetNextWindowSize(ImVec2(860, 300), ImGuiCond_Once);
+			if (ImGui::Begin("Page"))
+			{
+				ImGui::Text("%s at %.0f px", text.Language, size);
+				ImGui::PushFont(nullptr, size);
+				ImGui::TextWrapped("%s", text.Text);
+				ImGui::PopFont();
+			}
+			ImGui::End();
+		}
+
+		rlImGuiFontAtlasBudgetStats stats;
+		rlImGuiGetFontAtlasBudgetStats(&stats);
+
+		if (historyFrame % 15 == 0)
+		{
+			for (int i = 0; i < HistoryCount - 1; i++)
+			{
+				atlasHistory[i] = atlasHistory[i + 1];
+				occupancyHistory[i] = occupancyHistory[i + 1];
+			}
+			atlasHistory[HistoryCount - 1] = float(stats.TextureBytes / 1024.0);
+			occupancyHistory[HistoryCount - 1] = stats.Occupancy;
+		}
+		historyFrame++;
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(370, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Font Budget", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			bool changed = ImGui::Checkbox("Use Budget", &useBudget);
+			changed |= ImGui::SliderInt("Budget KB", &budgetKB, 256, 16384);
+			changed |= ImGui::SliderInt("Cold Frames", &coldFrames, 1, 1000);
+			if (changed)
+				rlImGuiSetFontAtlasBudget(useBudget ? budgetKB * 1024LL : 0, coldFrames);
+
+			if (ImGui::Button("Compact Now"))
+				rlImGuiCompactFontAtlas();
+
+			ImGui::SeparatorText("Atlas");
+			ImGui::Text("Texture %.1f KB (GPU and CPU copy each)", stats.TextureBytes / 1024.0);
+			ImGui::Text("Sizes %d, glyphs %d", stats.BakedSizes, stats.Glyphs);
+			ImGui::Text("Occupancy %.0f%%", stats.Occupancy * 100.0f);
+			ImGui::PlotLines("##Atlas", atlasHistory, HistoryCount, 0, "atlas KB", 0, 16384, ImVec2(340, 60));
+			ImGui::PlotLines("##Occupancy", occupancyHistory, HistoryCount, 0, "occupancy", 0, 1, ImVec2(340, 60));
+
+			ImGui::SeparatorText("Evictions");
+			ImGui::Text("Sizes %u, glyphs %u", stats.EvictedSizes, stats.EvictedGlyphs);
+			ImGui::Text("Rebakes %u, repacks %u", stats.Rebakes, stats.Repacks);
+			ImGui::Text("Time %.2f ms", stats.EvictSeconds * 1000.0);
+
+			if (!extraFont)
+				ImGui::TextUnformatted("Pass a font file to add the non Latin pages");
+		}
+		ImGui::End();
+
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiShutdown();
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
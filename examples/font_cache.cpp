@@ -0,0 +1,163 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Font Cache
+*
+*	This example measures startup with the font cache.
+*	The first run bakes every glyph and writes the cache file (a cold start), later runs load
+*	the glyphs from the file (a warm start). Run with --cold to delete the cache first.
+*	The text is drawn at several sizes so there are many glyphs to bake.
+*	Icons are baked when first drawn, the icons this example uses are pre-warmed after setup,
+*	and all icons can be baked to compare the atlas size.
+*	Run with --async to build the fonts on a worker thread while a loading screen is drawn.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+#include "extras/IconsFontAwesome6.h"
+
+#include <cstdio>
+#include <cstring>
+
+static constexpr const char* CacheFileName = "imgui_font_cache.bin";
+static constexpr float TextSizes[] = { 13, 18, 24, 32, 48 };
+static constexpr const char* UsedIcons = ICON_FA_FLOPPY_DISK ICON_FA_FOLDER_OPEN ICON_FA_TRASH ICON_FA_GEAR ICON_FA_MAGNIFYING_GLASS;
+
+static void DrawSampleText(void)
+{
+	for (float size : TextSizes)
+	{
+		ImGui::PushFont(nullptr, size);
+		ImGui::TextUnformatted("The quick brown fox jumps over the lazy dog 0123456789");
+		ImGui::TextUnformatted("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG !?#&%@()[]{}");
+		ImGui::TextUnformatted(UsedIcons);
+		ImGui::PopFont();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	bool cold = false;
+	bool async = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--cold") == 0)
+			cold = true;
+		else if (strcmp(argv[i], "--async") == 0)
+			async = true;
+	}
+	if (cold)
+		remove(CacheFileName);
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - font cache");
+	SetTargetFPS(144);
+
+	// startup is the setup and the first frame, that is when the glyphs are baked
+	double startupStart = GetTime();
+	bool warm = rlImGuiSetFontCacheFile(CacheFileName);
+
+	double splashMs = 0;
+	if (async)
+	{
+		// the fonts are built on a worker thread, raylib can draw a loading screen until they are ready
+		rlImGuiSetupAsync(true);
+		int splashFrames = 0;
+		while (!rlImGuiIsReady() && !WindowShouldClose())
+		{
+			BeginDrawing();
+			ClearBackground(DARKGRAY);
+			DrawText("Loading...", 20, 20, 40, RAYWHITE);
+			EndDrawing();
+
+			if (splashFrames++ == 0)
+				splashMs = (GetTime() - startupStart) * 1000.0;
+		}
+	}
+	else
+	{
+		rlImGuiSetup(true);
+	}
+	double setupMs = (GetTime() - startupStart) * 1000.0;
+
+	// bake the icons the UI uses with the first frame, instead of when each one is first drawn
+	for (float size : TextSizes)
+		rlImGuiPrewarmGlyphs(UsedIcons, size);
+
+	double firstFrameMs = 0;
+	bool firstFrame = true;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		double frameStart = GetTime();
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(900, 560), ImGuiCond_Once);
+		if (ImGui::Begin("Font Cache"))
+		{
+			rlImGuiFontCacheStats stats;
+			rlImGuiGetFontCacheStats(&stats);
+
+			ImGui::Text("%s start%s", warm ? "Warm" : "Cold", async ? ", fonts built on a worker thread" : "");
+			if (async)
+				ImGui::Text("First loading screen frame after %.2f ms", splashMs);
+			rlImGuiFontAtlasStats atlasStats;
+			rlImGuiGetFontAtlasStats(&atlasStats);
+
+			ImGui::Text("Setup %.2f ms, first frame %.2f ms, total %.2f ms", setupMs, firstFrameMs, setupMs + firstFrameMs);
+			ImGui::Text("Adding fonts %.2f ms", atlasStats.FontSetupSeconds * 1000.0);
+			ImGui::Text("Atlas %dx%d, pre-warmed %d glyphs in %.2f ms", atlasStats.AtlasWidth, atlasStats.AtlasHeight, atlasStats.PrewarmedGlyphs, atlasStats.PrewarmSeconds * 1000.0);
+			ImGui::Text("Cache file %.1f KB, %s, opened in %.3f ms", stats.FileBytes / 1024.0, stats.Mapped ? "memory mapped" : "read", stats.LoadSeconds * 1000.0);
+			ImGui::Text("Glyphs from file %d, new glyphs %d", stats.FileGlyphs, stats.NewGlyphs);
+			ImGui::Text("Cache hits %u, misses %u", stats.Hits, stats.Misses);
+
+			// icons are lazy by default, this bakes every icon to show what they would cost up front
+			if (ImGui::Button("Bake All Icons"))
+				rlImGuiPrewarmGlyphRange(ICON_MIN_FA, ICON_MAX_FA, 0);
+			ImGui::SameLine();
+			if (ImGui::Button("Delete Cache"))
+				remove(CacheFileName);
+			ImGui::SameLine();
+			ImGui::TextUnformatted("Restart to measure a cold start, or restart without deleting for a warm start");
+
+			ImGui::Separator();
+			DrawSampleText();
+		}
+		ImGui::End();
+
+		rlImGuiEnd();
+
+		// the first frame bakes the glyphs, so it is part of the startup time
+		if (firstFrame)
+		{
+			firstFrameMs = (GetTime() - frameStart) * 1000.0;
+			firstFrame = false;
+			TraceLog(LOG_INFO, "FONT CACHE: %s start, setup %.2f ms, first frame %.2f ms", warm ? "warm" : "cold", setupMs, firstFrameMs);
+		}
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiShutdown();    // saves any new glyphs to the cache file
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
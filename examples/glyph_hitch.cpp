@@ -0,0 +1,187 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Glyph Hitch
+*
+*	This example opens many localized windows for the first time, one every half second.
+*	Each window uses a new font size, so the glyphs are baked and uploaded in the frame
+*	the window opens, which shows up as a longer frame.
+*	The glyphs used are recorded to a file, and on the next launch they are baked during setup,
+*	so the windows open without the longer frames. Run with --fresh to delete the record first.
+*	Pass a font file with more scripts (such as a Noto font) to add Cyrillic, Greek and CJK windows.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <cstdio>
+#include <cstring>
+
+static constexpr const char* RecordFileName = "imgui_glyphs.bin";
+
+struct LocalizedText
+{
+	const char* Language;
+	const char* Text;
+	bool NeedsExtraFont;
+};
+
+static constexpr LocalizedText Languages[] =
+{
+	{ "English", "Open file, save changes, settings", false },
+	{ "Français", "Ouvrir le fichier, enregistrer les modifications, paramètres", false },
+	{ "Deutsch", "Datei öffnen, Änderungen speichern, Größe ändern", false },
+	{ "Español", "Abrir archivo, guardar cambios, configuración ¿Sí?", false },
+	{ "Português", "Abrir arquivo, salvar alterações, configurações", false },
+	{ "Italiano", "Apri file, salva modifiche, impostazioni", false },
+	{ "Nederlands", "Bestand openen, wijzigingen opslaan, instellingen", false },
+	{ "Dansk", "Åbn fil, gem ændringer, indstillinger", false },
+	{ "Svenska", "Öppna fil, spara ändringar, inställningar", false },
+	{ "Suomi", "Avaa tiedosto, tallenna muutokset, asetukset", false },
+	{ "Íslenska", "Opna skrá, vista breytingar, stillingar þýðing", false },
+	{ "Русский", "Открыть файл, сохранить изменения, настройки", true },
+	{ "Ελληνικά", "Άνοιγμα αρχείου, αποθήκευση αλλαγών, ρυθμίσεις", true },
+	{ "日本語", "ファイルを開く、変更を保存、設定", true },
+	{ "中文", "打开文件，保存更改，设置", true },
+	{ "한국어", "파일 열기, 변경 사항 저장, 설정", true },
+};
+static constexpr int LanguageCount = int(sizeof(Languages) / sizeof(Languages[0]));
+
+// every window shows its text at a few sizes nothing else uses
+static constexpr int WindowsPerLanguage = 3;
+static constexpr int WindowCount = LanguageCount * WindowsPerLanguage;
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	const char* extraFont = nullptr;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--fresh") == 0)
+			remove(RecordFileName);
+		else
+			extraFont = argv[i];
+	}
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - glyph hitch");
+	SetTargetFPS(144);
+
+	bool recorded = FileExists(RecordFileName);
+	rlImGuiSetGlyphRecordFile(RecordFileName);
+
+	rlImGuiBeginInitImGui();
+	ImGui::StyleColorsDark();
+	if (extraFont && FileExists(extraFont))
+	{
+		// merged into the default font, so it is only used for the characters the default font does not have
+		ImFontConfig config;
+		config.MergeMode = true;
+		ImGui::GetIO().Fonts->AddFontFromFileTTF(extraFont, 0.0f, &config);
+	}
+	else
+	{
+		extraFont = nullptr;
+	}
+	rlImGuiEndInitImGui();
+
+	rlImGuiFontAtlasStats startStats;
+	rlImGuiGetFontAtlasStats(&startStats);
+
+	int openWindows = 0;
+	double nextOpenTime = GetTime() + 1.0;
+	float openFrameMs[WindowCount] = { 0 };
+	float worstOpenMs = 0;
+	float lastFrameMs = 0;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		double frameStart = GetTime();
+		bool opening = openWindows < WindowCount && frameStart >= nextOpenTime;
+		if (opening)
+		{
+			openWindows++;
+			nextOpenTime = frameStart + 0.5;
+		}
+
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		for (int i = 0; i < openWindows; i++)
+		{
+			const LocalizedText& text = Languages[i % LanguageCount];
+			if (text.NeedsExtraFont && !extraFont)
+				continue;
+
+			float size = 14.0f + (i / LanguageCount) * 7.0f + (i % LanguageCount);
+
+			ImGui::SetNextWindowPos(ImVec2(380.0f + (i % 6) * 140.0f, 20.0f + (i / 6) * 60.0f), ImGuiCond_Once);
+			ImGui::SetNextWindowSize(ImVec2(420, 120), ImGuiCond_Once);
+			if (ImGui::Begin(TextFormat("%s %d", text.Language, i / LanguageCount)))
+			{
+				ImGui::PushFont(nullptr, size);
+				ImGui::TextWrapped("%s", text.Text);
+				ImGui::PopFont();
+			}
+			ImGui::End();
+		}
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(350, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Glyph Hitch", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			rlImGuiFontAtlasStats stats;
+			rlImGuiGetFontAtlasStats(&stats);
+
+			ImGui::Text("%s", recorded ? "Glyphs baked from the last session" : "No glyph record, first session");
+			ImGui::Text("Pre-warmed %d glyphs in %.2f ms", startStats.PrewarmedGlyphs, startStats.PrewarmSeconds * 1000.0);
+			ImGui::Text("Windows %d / %d", openWindows, WindowCount);
+			ImGui::Text("Worst frame opening a window %.2f ms", worstOpenMs);
+			ImGui::Text("Atlas %dx%d, updates %u, uploaded %.1f KB", stats.AtlasWidth, stats.AtlasHeight, stats.TextureUpdates, stats.TextureUploadBytes / 1024.0);
+			if (!extraFont)
+				ImGui::TextUnformatted("Pass a font file to add the non Latin windows");
+
+			if (ImGui::Button("Restart Windows"))
+			{
+				openWindows = 0;
+				worstOpenMs = 0;
+				nextOpenTime = GetTime() + 0.5;
+			}
+
+			ImGui::PlotHistogram("##OpenTimes", openFrameMs, WindowCount, 0, "frame ms per window", 0, 50, ImVec2(320, 80));
+		}
+		ImGui::End();
+
+		rlImGuiEnd();
+
+		lastFrameMs = float((GetTime() - frameStart) * 1000.0);
+		if (opening)
+		{
+			openFrameMs[openWindows - 1] = lastFrameMs;
+			if (lastFrameMs > worstOpenMs)
+				worstOpenMs = lastFrameMs;
+		}
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiShutdown();    // writes the glyphs used to the record
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
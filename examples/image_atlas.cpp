@@ -0,0 +1,184 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Image Atlas
+*
+*	This example draws 1000 thumbnails, each its own texture, in one window
+*	Drawn with rlImGuiImageSize every thumbnail is a draw call, with the image atlas they are copied
+*	into a few shared pages and drawn with a handful of draw calls.
+*	The window shows the draw calls and render time for both, and can remove and add thumbnails to show repacking.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+static constexpr int ThumbnailCount = 1000;
+static constexpr int ThumbnailSize = 64;
+
+struct Thumbnail
+{
+	Texture Source = { 0 };
+	rlImGuiAtlasImage* AtlasImage = nullptr;
+	bool Shown = true;
+};
+
+static Texture MakeThumbnail(int index)
+{
+	Color top = ColorFromHSV(float((index * 37) % 360), 0.6f, 0.9f);
+	Color bottom = ColorFromHSV(float((index * 37 + 120) % 360), 0.8f, 0.4f);
+	Image image = GenImageGradientLinear(ThumbnailSize, ThumbnailSize, 0, top, bottom);
+	ImageDrawRectangle(&image, 4, 4, 24, 14, Fade(BLACK, 0.5f));
+	ImageDrawText(&image, TextFormat("%d", index), 6, 6, 10, WHITE);
+
+	Texture texture = LoadTextureFromImage(image);
+	UnloadImage(image);
+	return texture;
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - image atlas");
+	rlImGuiSetup(true);
+
+	// 1000 64x64 thumbnails fit in two 2048 pages
+	rlImGuiSetImageAtlasLimits(2048, 4, 600);
+
+	static Thumbnail thumbnails[ThumbnailCount];
+	for (int i = 0; i < ThumbnailCount; i++)
+	{
+		thumbnails[i].Source = MakeThumbnail(i);
+		thumbnails[i].AtlasImage = rlImGuiAtlasAddTexture(&thumbnails[i].Source);
+	}
+
+	bool useAtlas = true;
+	float drawSize = 24;
+	int selected = -1;
+
+	int lastDrawCommands = 0;
+	float renderMs = 0;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(330, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Image Atlas", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			ImGui::Checkbox("Use Image Atlas", &useAtlas);
+			ImGui::SliderFloat("Size", &drawSize, 8, 64, "%.0f");
+
+			rlImGuiImageAtlasStats stats;
+			rlImGuiGetImageAtlasStats(&stats);
+
+			ImGui::SeparatorText("Last Frame");
+			ImGui::Text("Draw commands %d", lastDrawCommands);
+			ImGui::Text("rlImGuiEnd %.3f ms", renderMs);
+			ImGui::Text("From pages %d, from own texture %d", stats.AtlasDraws, stats.DirectDraws);
+
+			ImGui::SeparatorText("Pages");
+			ImGui::Text("Pages %d of %dx%d, occupancy %.0f%%", stats.Pages, stats.PageSize, stats.PageSize, stats.Occupancy * 100.0f);
+			ImGui::Text("Images %d, in pages %d", stats.Images, stats.ImagesInPages);
+			ImGui::Text("GPU copies %u, evictions %u, repacks %u", stats.GpuCopies, stats.Evictions, stats.Repacks);
+
+			// take out every other thumbnail and put it back, the pages have holes until they are repacked
+			if (ImGui::Button("Remove Odd"))
+			{
+				for (int i = 1; i < ThumbnailCount; i += 2)
+				{
+					rlImGuiAtlasRemove(thumbnails[i].AtlasImage);
+					thumbnails[i].AtlasImage = nullptr;
+					thumbnails[i].Shown = false;
+				}
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Add Odd"))
+			{
+				for (int i = 1; i < ThumbnailCount; i += 2)
+				{
+					if (!thumbnails[i].AtlasImage)
+						thumbnails[i].AtlasImage = rlImGuiAtlasAddTexture(&thumbnails[i].Source);
+					thumbnails[i].Shown = true;
+				}
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Compact"))
+				rlImGuiCompactImageAtlas();
+
+			if (selected >= 0)
+				ImGui::Text("Selected %d", selected);
+		}
+		ImGui::End();
+
+		ImGui::SetNextWindowPos(ImVec2(350, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(920, 780), ImGuiCond_Once);
+		if (ImGui::Begin("Thumbnails"))
+		{
+			// an image button draws its frame with the font texture, so a clickable image is an image and a click test
+			float width = ImGui::GetContentRegionAvail().x;
+			float x = 0;
+			for (int i = 0; i < ThumbnailCount; i++)
+			{
+				if (!thumbnails[i].Shown)
+					continue;
+
+				if (x > 0 && x + drawSize <= width)
+					ImGui::SameLine();
+				else
+					x = 0;
+
+				if (useAtlas)
+					rlImGuiImageFromAtlasSize(thumbnails[i].AtlasImage, Vector2{ drawSize, drawSize });
+				else
+					rlImGuiImageSize(&thumbnails[i].Source, int(drawSize), int(drawSize));
+
+				if (ImGui::IsItemClicked())
+					selected = i;
+
+				x += drawSize + ImGui::GetStyle().ItemSpacing.x;
+			}
+		}
+		ImGui::End();
+
+		double start = GetTime();
+		rlImGuiEnd();
+		renderMs = float((GetTime() - start) * 1000.0);
+
+		// every draw command is a draw call in the backend
+		lastDrawCommands = 0;
+		if (ImDrawData* drawData = ImGui::GetDrawData())
+		{
+			for (const ImDrawList* list : drawData->CmdLists)
+				lastDrawCommands += list->CmdBuffer.Size;
+		}
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiShutdown();
+	for (Thumbnail& thumbnail : thumbnails)
+		UnloadTexture(thumbnail.Source);
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
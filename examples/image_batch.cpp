@@ -0,0 +1,180 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Image Batch
+*
+*	This example draws a palette of 10,000 sprites from one sprite sheet three ways
+*	One rlImGuiImageRect call per sprite, one rlImGuiImageBatch call for the whole palette,
+*	and rlImGuiImageGrid, which only lays out and draws the rows that can be seen.
+*	The window shows the time spent building the palette and the draw commands and vertices it made.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <vector>
+
+static constexpr int SpriteCount = 10000;
+static constexpr int SheetCells = 16;
+static constexpr int SheetCellSize = 32;
+
+enum class DrawMode
+{
+	PerCall,
+	Batch,
+	Grid,
+};
+
+static Texture MakeSpriteSheet(void)
+{
+	Image sheet = GenImageColor(SheetCells * SheetCellSize, SheetCells * SheetCellSize, BLANK);
+	for (int y = 0; y < SheetCells; y++)
+	{
+		for (int x = 0; x < SheetCells; x++)
+		{
+			Color color = ColorFromHSV(float((x + y * SheetCells) * 360 / (SheetCells * SheetCells)), 0.7f, 0.9f);
+			int size = 12 + ((x + y) % 5) * 4;
+			int offset = (SheetCellSize - size) / 2;
+			ImageDrawRectangle(&sheet, x * SheetCellSize + offset, y * SheetCellSize + offset, size, size, color);
+		}
+	}
+
+	Texture texture = LoadTextureFromImage(sheet);
+	UnloadImage(sheet);
+	return texture;
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - image batch");
+	rlImGuiSetup(true);
+
+	Texture sheet = MakeSpriteSheet();
+
+	// every sprite is a cell of the sheet, the tint changes so the entries are not all the same
+	std::vector<rlImGuiImageBatchEntry> sprites(SpriteCount);
+	for (int i = 0; i < SpriteCount; i++)
+	{
+		int cell = i % (SheetCells * SheetCells);
+		sprites[i].Image = &sheet;
+		sprites[i].Source = Rectangle{ float((cell % SheetCells) * SheetCellSize), float((cell / SheetCells) * SheetCellSize), float(SheetCellSize), float(SheetCellSize) };
+		sprites[i].Tint = (i / (SheetCells * SheetCells)) % 2 ? WHITE : LIGHTGRAY;
+	}
+
+	DrawMode mode = DrawMode::Grid;
+	float cellSize = 20;
+	int selected = -1;
+
+	double buildMs = 0;
+	int lastDrawCommands = 0;
+	int lastVertices = 0;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(320, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Image Batch", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			int modeIndex = int(mode);
+			ImGui::RadioButton("rlImGuiImageRect per sprite", &modeIndex, int(DrawMode::PerCall));
+			ImGui::RadioButton("rlImGuiImageBatch", &modeIndex, int(DrawMode::Batch));
+			ImGui::RadioButton("rlImGuiImageGrid (clipped)", &modeIndex, int(DrawMode::Grid));
+			mode = DrawMode(modeIndex);
+
+			ImGui::SliderFloat("Cell Size", &cellSize, 8, 64, "%.0f");
+
+			ImGui::SeparatorText("Last Frame");
+			ImGui::Text("Palette built in %.3f ms", buildMs);
+			ImGui::Text("Draw commands %d, vertices %d", lastDrawCommands, lastVertices);
+			if (selected >= 0)
+				ImGui::Text("Selected sprite %d", selected);
+		}
+		ImGui::End();
+
+		ImGui::SetNextWindowPos(ImVec2(340, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(930, 780), ImGuiCond_Once);
+		if (ImGui::Begin("Palette"))
+		{
+			double start = GetTime();
+			switch (mode)
+			{
+			case DrawMode::PerCall:
+			{
+				float width = ImGui::GetContentRegionAvail().x;
+				float x = 0;
+				for (int i = 0; i < SpriteCount; i++)
+				{
+					if (x > 0 && x + cellSize <= width)
+						ImGui::SameLine();
+					else
+						x = 0;
+
+					rlImGuiImageRect(sprites[i].Image, int(cellSize), int(cellSize), sprites[i].Source);
+					if (ImGui::IsItemClicked())
+						selected = i;
+
+					x += cellSize + ImGui::GetStyle().ItemSpacing.x;
+				}
+				break;
+			}
+			case DrawMode::Batch:
+			{
+				// the layout could be kept between frames, it is done every frame here to count it in the time
+				rlImGuiLayoutImageGrid(sprites.data(), SpriteCount, Vector2{ cellSize, cellSize }, 0);
+				rlImGuiImageBatch(sprites.data(), SpriteCount);
+				break;
+			}
+			case DrawMode::Grid:
+			{
+				int clicked = rlImGuiImageGrid("Sprites", sprites.data(), SpriteCount, Vector2{ cellSize, cellSize }, 0, nullptr);
+				if (clicked >= 0)
+					selected = clicked;
+				break;
+			}
+			}
+			buildMs = (GetTime() - start) * 1000.0;
+		}
+		ImGui::End();
+
+		rlImGuiEnd();
+
+		lastDrawCommands = 0;
+		lastVertices = 0;
+		if (ImDrawData* drawData = ImGui::GetDrawData())
+		{
+			for (const ImDrawList* list : drawData->CmdLists)
+				lastDrawCommands += list->CmdBuffer.Size;
+			lastVertices = drawData->TotalVtxCount;
+		}
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiShutdown();
+	UnloadTexture(sheet);
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
@@ -0,0 +1,175 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Image Sampling
+*
+*	This example draws the same textures with different filters, wraps and shaders using image options
+*	Pixel art is drawn crisp and smooth from one texture, a photo like gradient is drawn smooth,
+*	a tile is repeated with a wrap mode and a gallery is drawn through a grayscale shader.
+*	The window shows how many option callbacks were rendered and how little state they changed.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+static constexpr int GalleryCount = 200;
+
+static const char* GrayscaleShader =
+	"#version 330\n"
+	"in vec2 fragTexCoord;\n"
+	"in vec4 fragColor;\n"
+	"uniform sampler2D texture0;\n"
+	"uniform vec4 colDiffuse;\n"
+	"out vec4 finalColor;\n"
+	"void main()\n"
+	"{\n"
+	"    vec4 texel = texture(texture0, fragTexCoord) * colDiffuse * fragColor;\n"
+	"    float gray = dot(texel.rgb, vec3(0.299, 0.587, 0.114));\n"
+	"    finalColor = vec4(gray, gray, gray, texel.a);\n"
+	"}\n";
+
+// a 16x16 face, the kind of sprite that is blurred by bilinear filtering
+static Texture MakePixelArt(void)
+{
+	Image image = GenImageColor(16, 16, BLANK);
+	ImageDrawRectangle(&image, 2, 2, 12, 12, GOLD);
+	ImageDrawRectangle(&image, 5, 5, 2, 2, BLACK);
+	ImageDrawRectangle(&image, 9, 5, 2, 2, BLACK);
+	ImageDrawRectangle(&image, 5, 10, 6, 1, MAROON);
+
+	Texture texture = LoadTextureFromImage(image);
+	UnloadImage(image);
+	return texture;
+}
+
+static Texture MakePhoto(void)
+{
+	Image image = GenImageGradientRadial(128, 128, 0.2f, SKYBLUE, DARKBLUE);
+	Texture texture = LoadTextureFromImage(image);
+	UnloadImage(image);
+	return texture;
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - image sampling");
+	SetTargetFPS(144);
+	rlImGuiSetup(true);
+
+	Texture pixelArt = MakePixelArt();
+	Texture photo = MakePhoto();
+	Shader grayscale = LoadShaderFromMemory(nullptr, GrayscaleShader);
+
+	// rlImGui sets the textures back to these after drawing them with other options, the photo is smooth everywhere
+	rlImGuiSetTextureSampler(&pixelArt, TEXTURE_FILTER_POINT, TEXTURE_WRAP_REPEAT);
+	rlImGuiSetTextureSampler(&photo, TEXTURE_FILTER_BILINEAR, TEXTURE_WRAP_CLAMP);
+
+	rlImGuiImageOptions crisp = rlImGuiDefaultImageOptions();
+	crisp.Filter = TEXTURE_FILTER_POINT;
+
+	rlImGuiImageOptions smooth = rlImGuiDefaultImageOptions();
+	smooth.Filter = TEXTURE_FILTER_BILINEAR;
+
+	rlImGuiImageOptions mirrored = rlImGuiDefaultImageOptions();
+	mirrored.Wrap = TEXTURE_WRAP_MIRROR_REPEAT;
+
+	rlImGuiImageOptions gray = rlImGuiDefaultImageOptions();
+	gray.DrawShader = grayscale;
+
+	bool grayGallery = true;
+	float tiles = 4;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(420, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Sampling", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			ImGui::SeparatorText("Pixel Art");
+			rlImGuiImageEx(&pixelArt, Vector2{ 128, 128 }, &crisp);
+			ImGui::SameLine();
+			rlImGuiImageEx(&pixelArt, Vector2{ 128, 128 }, &smooth);
+			ImGui::TextUnformatted("Point and bilinear, one texture");
+
+			ImGui::SeparatorText("Photo");
+			rlImGuiImageEx(&photo, Vector2{ 128, 128 }, nullptr);
+			ImGui::SameLine();
+			rlImGuiImageEx(&photo, Vector2{ 128, 128 }, &crisp);
+			ImGui::TextUnformatted("Its own bilinear filter and point");
+
+			// any ImGui image call between a push and a pop uses the options
+			ImGui::SeparatorText("Wrap");
+			ImGui::SliderFloat("Tiles", &tiles, 1, 8, "%.1f");
+			rlImGuiPushImageOptions(&mirrored);
+			ImGui::Image(ImTextureID(pixelArt.id), ImVec2(256, 128), ImVec2(0, 0), ImVec2(tiles * 2, tiles));
+			rlImGuiPopImageOptions();
+
+			rlImGuiImageOptionsStats stats;
+			rlImGuiGetImageOptionsStats(&stats);
+
+			ImGui::SeparatorText("Last Frame");
+			ImGui::Checkbox("Grayscale Gallery", &grayGallery);
+			ImGui::Text("Option callbacks %d", stats.OptionCommands);
+			ImGui::Text("Shader changes %d, sampler changes %d", stats.ShaderChanges, stats.SamplerChanges);
+		}
+		ImGui::End();
+
+		// every image has its own options, the renderer only changes the shader and sampler once for all of them
+		ImGui::SetNextWindowPos(ImVec2(440, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(830, 780), ImGuiCond_Once);
+		if (ImGui::Begin("Gallery"))
+		{
+			rlImGuiImageOptions options = grayGallery ? gray : crisp;
+			options.Filter = TEXTURE_FILTER_POINT;
+
+			float width = ImGui::GetContentRegionAvail().x;
+			float x = 0;
+			for (int i = 0; i < GalleryCount; i++)
+			{
+				if (x > 0 && x + 48 <= width)
+					ImGui::SameLine();
+				else
+					x = 0;
+
+				rlImGuiImageEx(&pixelArt, Vector2{ 48, 48 }, &options);
+
+				x += 48 + ImGui::GetStyle().ItemSpacing.x;
+			}
+		}
+		ImGui::End();
+
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiShutdown();
+	UnloadShader(grayscale);
+	UnloadTexture(photo);
+	UnloadTexture(pixelArt);
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
@@ -0,0 +1,174 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Input Events
+*
+*	This example checks that clicks faster than the frame rate all reach ImGui.
+*	Press SPACE to send 10 clicks through the GLFW mouse button callback in a single frame,
+*	the example counts every press and release ImGui sees in the frames after that.
+*	Needs rlImGui built with RLIMGUI_GLFW_EVENTS (premake5 --glfw-events), raylib only keeps the last state of a frame.
+*	Run it with --check to send the burst in a hidden window and exit with 1 if a click was dropped or came out of order.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <string.h>
+
+#if defined(RLIMGUI_GLFW_EVENTS)
+#define GLFW_INCLUDE_NONE
+#include "GLFW/glfw3.h"
+#endif
+
+static constexpr int BurstClicks = 10;
+
+struct ClickBurst
+{
+	bool Running = false;
+	bool Done = false;
+	int Presses = 0;
+	int Releases = 0;
+	int Frames = 0;
+	bool ButtonDown = false;
+	bool OutOfOrder = false;
+};
+
+// calls the installed callback the same way GLFW does when the OS sends the clicks
+static bool SendClickBurst(void)
+{
+#if defined(RLIMGUI_GLFW_EVENTS)
+	GLFWwindow* window = (GLFWwindow*)GetWindowHandle();
+	GLFWmousebuttonfun callback = glfwSetMouseButtonCallback(window, nullptr);
+	glfwSetMouseButtonCallback(window, callback);
+	if (!callback)
+		return false;
+
+	for (int i = 0; i < BurstClicks; i++)
+	{
+		callback(window, GLFW_MOUSE_BUTTON_LEFT, GLFW_PRESS, 0);
+		callback(window, GLFW_MOUSE_BUTTON_LEFT, GLFW_RELEASE, 0);
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	bool check = argc > 1 && strcmp(argv[1], "--check") == 0;
+
+	SetConfigFlags(check ? FLAG_WINDOW_HIDDEN : (FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE));
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - input events");
+	SetTargetFPS(60);
+	rlImGuiSetup(true);
+
+	ClickBurst burst;
+
+	if (check)
+	{
+		// the check needs one change per frame to see every click
+		ImGui::GetIO().ConfigInputTrickleEventQueue = true;
+		if (!SendClickBurst())
+		{
+			TraceLog(LOG_ERROR, "INPUT CHECK: no GLFW mouse button callback, build rlImGui with RLIMGUI_GLFW_EVENTS");
+			rlImGuiShutdown();
+			CloseWindow();
+			return 1;
+		}
+		burst = ClickBurst{ true };
+	}
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		// the clicks go into the queue before the frame starts, like events polled at the end of the last frame
+		if (IsKeyPressed(KEY_SPACE) && !burst.Running && SendClickBurst())
+			burst = ClickBurst{ true };
+
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		ImGuiIO& io = ImGui::GetIO();
+		if (burst.Running)
+		{
+			// every press has to come before its release, a second press while down means the order was lost
+			if (ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+			{
+				burst.OutOfOrder |= burst.ButtonDown;
+				burst.ButtonDown = true;
+				burst.Presses++;
+			}
+			if (ImGui::IsMouseReleased(ImGuiMouseButton_Left))
+			{
+				burst.OutOfOrder |= !burst.ButtonDown;
+				burst.ButtonDown = false;
+				burst.Releases++;
+			}
+			burst.Frames++;
+
+			// one press and one release per frame when the queue is trickled, so give it a few frames more than that
+			if (burst.Releases >= BurstClicks || burst.Frames > BurstClicks * 2 + 10)
+			{
+				burst.Running = false;
+				burst.Done = true;
+			}
+		}
+
+		ImGui::SetNextWindowPos(ImVec2(20, 20), ImGuiCond_Once);
+		if (ImGui::Begin("Input Events", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+#if defined(RLIMGUI_GLFW_EVENTS)
+			ImGui::Text("Press SPACE to send %d clicks in one frame", BurstClicks);
+#else
+			ImGui::TextColored(ImVec4(1, 0.6f, 0.2f, 1), "Build rlImGui with RLIMGUI_GLFW_EVENTS to run the check");
+#endif
+			ImGui::Checkbox("Trickle Event Queue", &io.ConfigInputTrickleEventQueue);
+			ImGui::Separator();
+
+			ImGui::Text("Presses  %d / %d", burst.Presses, BurstClicks);
+			ImGui::Text("Releases %d / %d", burst.Releases, BurstClicks);
+			ImGui::Text("Frames   %d", burst.Frames);
+
+			if (burst.Done)
+			{
+				bool passed = burst.Presses == BurstClicks && burst.Releases == BurstClicks && !burst.OutOfOrder;
+				ImGui::TextColored(passed ? ImVec4(0.3f, 1, 0.3f, 1) : ImVec4(1, 0.3f, 0.3f, 1), passed ? "Every click arrived" : (burst.OutOfOrder ? "Clicks arrived out of order" : "Clicks were merged"));
+				if (!passed && !io.ConfigInputTrickleEventQueue)
+					ImGui::TextDisabled("Without trickling ImGui applies all the events in one frame");
+			}
+		}
+		ImGui::End();
+
+		rlImGuiEnd();
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+
+		if (check && burst.Done)
+			break;
+	}
+
+	bool passed = burst.Done && burst.Presses == BurstClicks && burst.Releases == BurstClicks && !burst.OutOfOrder;
+	if (check)
+		TraceLog(passed ? LOG_INFO : LOG_ERROR, "INPUT CHECK: %d presses, %d releases of %d in %d frames%s", burst.Presses, burst.Releases, BurstClicks, burst.Frames, burst.OutOfOrder ? ", out of order" : "");
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiShutdown();
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return (check && !passed) ? 1 : 0;
+}
@@ -0,0 +1,270 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Large Image
+*
+*	This example shows a 32768x32768 image, far bigger than a GPU texture can be, as a tiled large image
+*	The tiles are made by a loader on worker threads, with a slider to add a decode time to each tile.
+*	The image can also be written to a tiled file and streamed from disk, at 8192x8192 so the file is quick to write.
+*	The benchmark pans and zooms the view on a fixed path and reports the frame times and the tiles it loaded.
+*	VSync is off so the frame time shows the real cost of a frame.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+static constexpr int SyntheticSize = 32768;
+static constexpr int FileSize = 8192;
+static constexpr float BenchmarkSeconds = 10;
+static const char* FileName = "large_image.rlli";
+
+struct SyntheticImage
+{
+	int Width = 0;
+	int Height = 0;
+	std::atomic<int> DecodeMs{ 0 };
+};
+
+// a color ramp across the image, a checker of 512 pixels and a grid line every 4096 pixels, at any level
+static bool LoadSyntheticTile(int level, int x, int y, int width, int height, unsigned char* pixels, void* userData)
+{
+	const SyntheticImage& image = *static_cast<const SyntheticImage*>(userData);
+	float texel = float(1 << level);
+
+	for (int j = 0; j < height; j++)
+	{
+		float imageY = (y + j + 0.5f) * texel;
+		for (int i = 0; i < width; i++)
+		{
+			float imageX = (x + i + 0.5f) * texel;
+			unsigned char* pixel = pixels + (size_t(j) * width + i) * 4;
+
+			// the checker is averaged away on levels where a texel is bigger than a square
+			float shade = texel >= 512 ? 0.75f : (((int(imageX) / 512 + int(imageY) / 512) & 1) ? 1.0f : 0.5f);
+			bool line = fmodf(imageX, 4096) < 8 * texel || fmodf(imageY, 4096) < 8 * texel;
+
+			pixel[0] = line ? 255 : (unsigned char)(255 * imageX / image.Width * shade);
+			pixel[1] = line ? 255 : (unsigned char)(255 * imageY / image.Height * shade);
+			pixel[2] = line ? 255 : (unsigned char)(160 * shade);
+			pixel[3] = 255;
+		}
+	}
+
+	// stands in for reading and decoding a tile of a real image
+	int decodeMs = image.DecodeMs.load(std::memory_order_relaxed);
+	if (decodeMs > 0)
+		WaitTime(decodeMs / 1000.0);
+
+	return true;
+}
+
+struct Benchmark
+{
+	bool Running = false;
+	float Time = 0;
+	std::vector<float> FrameMs;
+	rlImGuiLargeImageStats StartStats = { 0 };
+
+	float AverageMs = 0;
+	float P99Ms = 0;
+	float MaxMs = 0;
+	unsigned int Loads = 0;
+	unsigned int Evictions = 0;
+	int MostFallbacks = 0;
+};
+
+// pans across the image at 1:1 for the first half, then zooms from the whole image to 4:1 and back
+static void UpdateBenchmarkView(rlImGuiLargeImage* image, float time)
+{
+	Vector2 size = rlImGuiGetLargeImageSize(image);
+	float t = time / BenchmarkSeconds;
+
+	if (t < 0.5f)
+	{
+		float pan = t * 2;
+		rlImGuiSetLargeImageView(image, Vector2{ size.x * (0.1f + 0.8f * pan), size.y * (0.5f + 0.3f * sinf(pan * 6.28f)) }, 1.0f);
+	}
+	else
+	{
+		float zoom = (t - 0.5f) * 2;
+		float fit = 800.0f / size.x;
+		float scale = fit * powf(4.0f / fit, sinf(zoom * 3.14159f));
+		rlImGuiSetLargeImageView(image, Vector2{ size.x * 0.37f, size.y * 0.61f }, scale);
+	}
+}
+
+static void FinishBenchmark(Benchmark& benchmark)
+{
+	benchmark.Running = false;
+	if (benchmark.FrameMs.empty())
+		return;
+
+	std::vector<float> sorted = benchmark.FrameMs;
+	std::sort(sorted.begin(), sorted.end());
+
+	double total = 0;
+	for (float ms : sorted)
+		total += ms;
+
+	benchmark.AverageMs = float(total / sorted.size());
+	benchmark.P99Ms = sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)];
+	benchmark.MaxMs = sorted.back();
+
+	rlImGuiLargeImageStats stats;
+	rlImGuiGetLargeImageStats(&stats);
+	benchmark.Loads = stats.Loads - benchmark.StartStats.Loads;
+	benchmark.Evictions = stats.Evictions - benchmark.StartStats.Evictions;
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - large image");
+	rlImGuiSetup(true);
+
+	SyntheticImage synthetic;
+	synthetic.Width = SyntheticSize;
+	synthetic.Height = SyntheticSize;
+
+	rlImGuiLargeImage* image = rlImGuiCreateLargeImage(synthetic.Width, synthetic.Height, LoadSyntheticTile, &synthetic);
+	bool fromFile = false;
+	double exportSeconds = 0;
+
+	int decodeMs = 0;
+	int budgetMB = 256;
+	Benchmark benchmark;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		if (benchmark.Running)
+		{
+			benchmark.FrameMs.push_back(GetFrameTime() * 1000.0f);
+			benchmark.Time += GetFrameTime();
+
+			if (benchmark.Time >= BenchmarkSeconds)
+				FinishBenchmark(benchmark);
+			else
+				UpdateBenchmarkView(image, benchmark.Time);
+		}
+
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		rlImGuiLargeImageStats stats;
+		rlImGuiGetLargeImageStats(&stats);
+		if (benchmark.Running)
+			benchmark.MostFallbacks = std::max(benchmark.MostFallbacks, stats.FallbackTiles);
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(340, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Large Image", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			Vector2 size = rlImGuiGetLargeImageSize(image);
+			ImGui::Text("%.0fx%.0f %s", size.x, size.y, fromFile ? "from the tiled file" : "from the loader");
+
+			if (!fromFile && ImGui::Button("Write and open the tiled file"))
+			{
+				// no worker uses the loader once the image is destroyed
+				rlImGuiDestroyLargeImage(image);
+
+				// the decode time is only for streaming, the file is written as fast as it can be
+				synthetic.DecodeMs = 0;
+				synthetic.Width = FileSize;
+				synthetic.Height = FileSize;
+
+				double start = GetTime();
+				if (rlImGuiExportLargeImage(FileName, FileSize, FileSize, LoadSyntheticTile, &synthetic))
+				{
+					exportSeconds = GetTime() - start;
+					image = rlImGuiLoadLargeImage(FileName);
+					fromFile = image != nullptr;
+				}
+
+				if (!fromFile)
+				{
+					synthetic.Width = SyntheticSize;
+					synthetic.Height = SyntheticSize;
+					image = rlImGuiCreateLargeImage(synthetic.Width, synthetic.Height, LoadSyntheticTile, &synthetic);
+				}
+			}
+			if (fromFile)
+				ImGui::Text("Written in %.2f s", exportSeconds);
+
+			if (!fromFile && ImGui::SliderInt("Decode ms", &decodeMs, 0, 50))
+				synthetic.DecodeMs = decodeMs;
+			if (ImGui::SliderInt("Budget MB", &budgetMB, 16, 1024))
+				rlImGuiSetLargeImageLimits((long long)budgetMB * 1024 * 1024, 0);
+
+			ImGui::SeparatorText("Tiles");
+			ImGui::Text("Loaded %d, %.1f of %.0f MB", stats.Tiles, stats.TileBytes / (1024.0 * 1024.0), stats.BudgetBytes / (1024.0 * 1024.0));
+			ImGui::Text("Drawn %d, from a coarser level %d", stats.TilesDrawn, stats.FallbackTiles);
+			ImGui::Text("Pending %d, %.2f ms per tile", stats.PendingTiles, stats.AverageLoadMs);
+			ImGui::Text("Loads %u, evictions %u, cancels %u", stats.Loads, stats.Evictions, stats.Cancels);
+			ImGui::Text("Frame %.2f ms", GetFrameTime() * 1000.0f);
+
+			ImGui::SeparatorText("Benchmark");
+			if (benchmark.Running)
+			{
+				ImGui::ProgressBar(benchmark.Time / BenchmarkSeconds);
+			}
+			else if (ImGui::Button("Run"))
+			{
+				benchmark = Benchmark();
+				benchmark.Running = true;
+				rlImGuiGetLargeImageStats(&benchmark.StartStats);
+			}
+
+			if (!benchmark.Running && !benchmark.FrameMs.empty())
+			{
+				ImGui::Text("%d frames, average %.2f ms", int(benchmark.FrameMs.size()), benchmark.AverageMs);
+				ImGui::Text("99th percentile %.2f ms, worst %.2f ms", benchmark.P99Ms, benchmark.MaxMs);
+				ImGui::Text("Tiles loaded %u, evicted %u", benchmark.Loads, benchmark.Evictions);
+				ImGui::Text("Most tiles from a coarser level %d", benchmark.MostFallbacks);
+				ImGui::PlotLines("##FrameMs", benchmark.FrameMs.data(), int(benchmark.FrameMs.size()), 0, "frame ms", 0, benchmark.P99Ms * 1.5f, ImVec2(ImGui::GetContentRegionAvail().x, 60));
+			}
+		}
+		ImGui::End();
+
+		// the benchmark path is made for a view of this size
+		ImGui::SetNextWindowPos(ImVec2(360, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(900, 780), ImGuiCond_Once);
+		ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
+		if (ImGui::Begin("View", nullptr, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse))
+			rlImGuiLargeImageView(image, Vector2{ 0, 0 });
+		ImGui::End();
+		ImGui::PopStyleVar();
+
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiDestroyLargeImage(image);
+	rlImGuiShutdown();
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
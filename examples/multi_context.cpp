@@ -0,0 +1,260 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Multiple Contexts
+*
+*	This example runs three extra ImGui contexts next to the default one
+*	A debug overlay with no input, a screen drawn into a render texture that is updated
+*	at a lower rate, and a tool window that gets input.
+*	The default context shows how long each context takes and what switching costs.
+*	It can also make 8 more contexts to show that they share one font atlas texture.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+struct ContextTiming
+{
+	const char* Name = nullptr;
+	double Total = 0;
+	int Frames = 0;
+
+	void Add(double seconds)
+	{
+		Total += seconds;
+		Frames++;
+	}
+
+	double AverageMs() const
+	{
+		return Frames > 0 ? (Total / Frames) * 1000.0 : 0.0;
+	}
+};
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - multiple contexts");
+	SetTargetFPS(144);
+
+	double setupStart = GetTime();
+	rlImGuiSetup(true);
+	double setupMs = (GetTime() - setupStart) * 1000.0;
+
+	// a debug overlay that never takes the mouse
+	rlImGuiContext* overlay = rlImGuiCreateContext(true);
+	rlImGuiSetContextInput(overlay, false, nullptr);
+
+	// a screen drawn into a texture, updated every 4th frame
+	RenderTexture screenTexture = LoadRenderTexture(400, 300);
+	Rectangle screenRect = { 40, 380, 400, 300 };
+	rlImGuiContext* screen = rlImGuiCreateContext(false);
+	rlImGuiSetContextTarget(screen, &screenTexture);
+	rlImGuiSetContextInput(screen, true, &screenRect);
+
+	// a tool window that is updated every frame
+	rlImGuiContext* tools = rlImGuiCreateContext(true);
+
+	ContextTiming timings[4];
+	timings[0].Name = "Default";
+	timings[1].Name = "Overlay";
+	timings[2].Name = "Render Texture";
+	timings[3].Name = "Tools";
+
+	int frame = 0;
+	float screenDelta = 0;
+	int clicks = 0;
+	float toolValue = 0.5f;
+
+	double switchNs = 0;
+
+	// a batch of contexts to compare the cost of 1 and 8 contexts
+	constexpr int batchSize = 8;
+	rlImGuiContext* batch[batchSize] = { 0 };
+	bool batchActive = false;
+	double batchCreateMs = 0;
+	long long batchBytesBefore = 0;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		// the render texture context only runs every 4th frame, with the time and the input since it last ran
+		screenDelta += GetFrameTime();
+		if (frame % 4 == 0)
+		{
+			double start = GetTime();
+			rlImGuiBeginContextDelta(screen, screenDelta);
+
+			ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+			if (ImGui::Begin("In World Screen"))
+			{
+				ImGui::Text("Updated every 4th frame");
+				if (ImGui::Button("Click Me"))
+					clicks++;
+				ImGui::Text("Clicks %d", clicks);
+			}
+			ImGui::End();
+
+			rlImGuiEndContext(screen);
+			timings[2].Add(GetTime() - start);
+			screenDelta = 0;
+		}
+
+		DrawTexturePro(screenTexture.texture, Rectangle{ 0, 0, float(screenTexture.texture.width), -float(screenTexture.texture.height) }, screenRect, Vector2Zero(), 0, WHITE);
+		DrawRectangleLinesEx(screenRect, 2, SKYBLUE);
+
+		double start = GetTime();
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(20, 20), ImGuiCond_Once);
+		if (ImGui::Begin("Context Benchmark"))
+		{
+			if (ImGui::BeginTable("Timings", 2))
+			{
+				ImGui::TableSetupColumn("Context");
+				ImGui::TableSetupColumn("Begin to End (ms)");
+				ImGui::TableHeadersRow();
+				for (const ContextTiming& timing : timings)
+				{
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(timing.Name);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.3f", timing.AverageMs());
+				}
+				ImGui::EndTable();
+			}
+
+			if (ImGui::Button("Measure Switch Cost"))
+			{
+				// time a begin and end of an empty context, while the default frame is open
+				constexpr int iterations = 1000;
+				rlImGuiSetContextInput(overlay, false, nullptr);
+				double switchStart = GetTime();
+				for (int i = 0; i < iterations; i++)
+				{
+					rlImGuiBeginContextDelta(overlay, 0.001f);
+					rlImGuiEndContext(overlay);
+				}
+				switchNs = ((GetTime() - switchStart) / iterations) * 1000000000.0;
+			}
+			if (switchNs > 0)
+				ImGui::Text("Empty context begin and end: %.0f ns", switchNs);
+
+			rlImGuiFontAtlasStats atlasStats;
+			rlImGuiGetFontAtlasStats(&atlasStats);
+
+			ImGui::SeparatorText("Font Atlas");
+			ImGui::Text("rlImGuiSetup %.2f ms, fonts %.2f ms", setupMs, atlasStats.FontSetupSeconds * 1000.0);
+			ImGui::Text("Contexts %d, atlas %dx%d", atlasStats.ContextCount, atlasStats.AtlasWidth, atlasStats.AtlasHeight);
+			ImGui::Text("GPU textures %d, %.1f KB", atlasStats.TextureCount, atlasStats.TextureBytes / 1024.0);
+			ImGui::Text("Creates %u, updates %u", atlasStats.TextureCreates, atlasStats.TextureUpdates);
+
+			if (!batchActive && ImGui::Button("Create 8 Contexts"))
+			{
+				batchBytesBefore = atlasStats.TextureBytes;
+				double batchStart = GetTime();
+				for (int i = 0; i < batchSize; i++)
+					batch[i] = rlImGuiCreateContext(true);
+				batchCreateMs = (GetTime() - batchStart) * 1000.0;
+				batchActive = true;
+			}
+			else if (batchActive && ImGui::Button("Destroy 8 Contexts"))
+			{
+				for (int i = 0; i < batchSize; i++)
+					rlImGuiDestroyContext(batch[i]);
+				batchActive = false;
+			}
+
+			if (batchCreateMs > 0)
+				ImGui::Text("8 contexts made in %.2f ms, GPU memory %+.1f KB", batchCreateMs, (atlasStats.TextureBytes - batchBytesBefore) / 1024.0);
+
+			ImGui::Separator();
+			if (ImGui::Button("Reset Timings"))
+			{
+				for (ContextTiming& timing : timings)
+				{
+					timing.Total = 0;
+					timing.Frames = 0;
+				}
+			}
+		}
+		ImGui::End();
+
+		// an extra context can run inside the default frame, the default context is active again after it ends
+		double toolsStart = GetTime();
+		rlImGuiBeginContext(tools);
+		ImGui::SetNextWindowPos(ImVec2(500, 20), ImGuiCond_Once);
+		if (ImGui::Begin("Tools"))
+		{
+			ImGui::SliderFloat("Value", &toolValue, 0, 1);
+		}
+		ImGui::End();
+		rlImGuiEndContext(tools);
+		timings[3].Add(GetTime() - toolsStart);
+
+		rlImGuiEnd();
+		timings[0].Add(GetTime() - start);
+
+		// the batch contexts draw text, so they use the shared glyphs
+		if (batchActive)
+		{
+			for (int i = 0; i < batchSize; i++)
+			{
+				rlImGuiBeginContext(batch[i]);
+				ImGui::SetNextWindowPos(ImVec2(float(GetScreenWidth() - 200), 120.0f + i * 40), ImGuiCond_Always);
+				if (ImGui::Begin(TextFormat("Batch %d", i), nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoInputs))
+					ImGui::Text("Context %d", i);
+				ImGui::End();
+				rlImGuiEndContext(batch[i]);
+			}
+		}
+
+		double overlayStart = GetTime();
+		rlImGuiBeginContext(overlay);
+		ImGui::SetNextWindowPos(ImVec2(float(GetScreenWidth() - 220), 20), ImGuiCond_Always);
+		ImGui::SetNextWindowBgAlpha(0.5f);
+		if (ImGui::Begin("Overlay", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoInputs))
+		{
+			ImGui::Text("FPS %d", GetFPS());
+			ImGui::Text("Frame %d", frame);
+		}
+		ImGui::End();
+		rlImGuiEndContext(overlay);
+		timings[1].Add(GetTime() - overlayStart);
+
+		EndDrawing();
+		frame++;
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	if (batchActive)
+	{
+		for (int i = 0; i < batchSize; i++)
+			rlImGuiDestroyContext(batch[i]);
+	}
+	rlImGuiDestroyContext(tools);
+	rlImGuiDestroyContext(screen);
+	rlImGuiDestroyContext(overlay);
+	rlImGuiShutdown();
+	UnloadRenderTexture(screenTexture);
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
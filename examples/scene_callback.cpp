@@ -0,0 +1,185 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Scene Callback
+*
+*	This example draws a 3D scene in four windows, either into viewport render textures or as scenes
+*	A scene is drawn by a callback straight into the window when ImGui is rendered, with no render texture.
+*	Switch between the two to compare the GPU memory of the view textures and the frame time.
+*	VSync is off so the frame time shows the real cost of a frame.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <cmath>
+
+static constexpr int ViewCount = 4;
+
+struct SceneView
+{
+	rlImGuiViewport* Viewport = nullptr;
+	Camera3D Camera = { 0 };
+	const char* Name = nullptr;
+	int Load = 0;
+	float Time = 0;
+};
+
+static void DrawScene(int load, float time)
+{
+	DrawPlane(Vector3{ 0, 0, 0 }, Vector2{ 60, 60 }, BEIGE);
+
+	float spacing = 50.0f / load;
+	for (int x = 0; x < load; x++)
+	{
+		for (int z = 0; z < load; z++)
+		{
+			Vector3 position = { -25 + x * spacing, 0, -25 + z * spacing };
+			float height = 1 + 0.5f * sinf(time + x * 0.3f + z * 0.2f);
+			DrawCube(Vector3{ position.x, height / 2, position.z }, spacing * 0.5f, height, spacing * 0.5f, ColorFromHSV(float((x * 7 + z * 3) % 360), 0.6f, 0.9f));
+		}
+	}
+}
+
+// called by rlImGui while it renders the window, the GL viewport is already the item
+static void DrawSceneView(Vector2 size, void* userData)
+{
+	SceneView& view = *static_cast<SceneView*>(userData);
+
+	ClearBackground(SKYBLUE);
+	rlImGuiBeginSceneMode3D(view.Camera);
+	DrawScene(view.Load, view.Time);
+	EndMode3D();
+
+	DrawText(view.Name, 10, 10, 20, BLACK);
+	DrawText(TextFormat("%.0fx%.0f", size.x, size.y), 10, int(size.y) - 30, 20, BLACK);
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - scene callback");
+	rlImGuiSetup(true);
+
+	static const char* names[ViewCount] = { "Front", "Side", "Top", "Orbit" };
+	static const Vector3 positions[ViewCount] = { { 0, 10, 40 }, { 40, 10, 0 }, { 0, 60, 1 }, { 30, 25, 30 } };
+
+	SceneView views[ViewCount];
+	for (int i = 0; i < ViewCount; i++)
+	{
+		views[i].Viewport = rlImGuiCreateViewport();
+		views[i].Name = names[i];
+		views[i].Camera.position = positions[i];
+		views[i].Camera.up.y = 1;
+		views[i].Camera.fovy = 45;
+		views[i].Camera.projection = CAMERA_PERSPECTIVE;
+	}
+
+	bool useScenes = true;
+	int load = 20;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		float time = float(GetTime());
+		views[3].Camera.position = Vector3{ cosf(time * 0.2f) * 40, 25, sinf(time * 0.2f) * 40 };
+
+		for (SceneView& view : views)
+		{
+			view.Load = load;
+			view.Time = time;
+		}
+
+		// with viewports every view is drawn into its texture before the frame starts
+		if (!useScenes)
+		{
+			for (SceneView& view : views)
+			{
+				if (!rlImGuiBeginViewportTexture(view.Viewport))
+					continue;
+
+				ClearBackground(SKYBLUE);
+				rlImGuiBeginViewportMode3D(view.Viewport, view.Camera);
+				DrawScene(view.Load, view.Time);
+				EndMode3D();
+				DrawText(view.Name, 10, 10, 20, BLACK);
+				rlImGuiEndViewportTexture(view.Viewport);
+			}
+		}
+		else
+		{
+			// the textures go back to the pool, so the memory shown is what the scenes save
+			rlImGuiTrimRenderTexturePool();
+		}
+
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(300, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Settings", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			if (ImGui::RadioButton("Scenes", useScenes))
+				useScenes = true;
+			ImGui::SameLine();
+			if (ImGui::RadioButton("Viewports", !useScenes))
+				useScenes = false;
+
+			ImGui::SliderInt("Load", &load, 5, 100);
+			ImGui::Text("Frame %.2f ms", GetFrameTime() * 1000.0f);
+
+			rlImGuiRenderTexturePoolStats poolStats;
+			rlImGuiGetRenderTexturePoolStats(&poolStats);
+			ImGui::Text("View textures %d, %.1f MB", poolStats.Textures, poolStats.TextureBytes / (1024.0 * 1024.0));
+
+			rlImGuiSceneStats sceneStats;
+			rlImGuiGetSceneStats(&sceneStats);
+			ImGui::Text("Scenes %d, drawn in %.2f ms", sceneStats.Scenes, sceneStats.DrawMs);
+		}
+		ImGui::End();
+
+		for (int i = 0; i < ViewCount; i++)
+		{
+			SceneView& view = views[i];
+
+			ImGui::SetNextWindowPos(ImVec2(320.0f + (i % 2) * 475, 10.0f + (i / 2) * 390), ImGuiCond_Once);
+			ImGui::SetNextWindowSize(ImVec2(470, 385), ImGuiCond_Once);
+			if (ImGui::Begin(view.Name))
+			{
+				if (useScenes)
+					rlImGuiScene(Vector2{ 0, 0 }, DrawSceneView, &view);
+				else
+					rlImGuiViewportImage(view.Viewport, Vector2{ 0, 0 });
+			}
+			ImGui::End();
+		}
+
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	for (SceneView& view : views)
+		rlImGuiDestroyViewport(view.Viewport);
+	rlImGuiShutdown();
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - SDF Fonts
+*
+*	This example draws text at many sizes and zoom levels and shows what it costs the font atlas
+*	Run it with --sdf to bake the glyphs once as distance fields and compare it with the normal mode
+*	The sweep button zooms through every scale, the stats show how much the atlas grew
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <string.h>
+
+static const float TextSizes[] = { 8, 10, 13, 16, 20, 24, 32, 48, 64, 96 };
+
+int main(int argc, char* argv[])
+{
+	bool sdf = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--sdf") == 0)
+			sdf = true;
+	}
+
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, sdf ? "raylib-Extras [ImGui] example - SDF fonts (distance field)" : "raylib-Extras [ImGui] example - SDF fonts (normal)");
+	SetTargetFPS(144);
+
+	// the mode has to be picked before the fonts are made
+	rlImGuiSetSdfFonts(sdf, 32);
+	rlImGuiSetup(true);
+
+	float zoom = 1;
+	bool sweeping = false;
+	float sweepTime = 0;
+	float bigTextSize = 160;
+
+	long long peakTextureBytes = 0;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		if (sweeping)
+		{
+			// zoom from 0.5 to 4 in 0.05 steps, every step is a new font size
+			sweepTime += GetFrameTime();
+			int step = int(sweepTime * 30);
+			zoom = 0.5f + step * 0.05f;
+			if (zoom >= 4)
+			{
+				zoom = 1;
+				sweeping = false;
+			}
+		}
+
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		rlImGuiFontAtlasStats stats;
+		rlImGuiGetFontAtlasStats(&stats);
+		if (stats.TextureBytes > peakTextureBytes)
+			peakTextureBytes = stats.TextureBytes;
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(360, 300), ImGuiCond_Once);
+		if (ImGui::Begin("Font Atlas"))
+		{
+			ImGui::Text("Mode: %s", rlImGuiIsSdfFonts() ? "distance field" : "normal");
+			ImGui::Text("Atlas %dx%d", stats.AtlasWidth, stats.AtlasHeight);
+			ImGui::Text("GPU memory %.1f KB, peak %.1f KB", stats.TextureBytes / 1024.0, peakTextureBytes / 1024.0);
+			ImGui::Text("Texture creates %u, updates %u", stats.TextureCreates, stats.TextureUpdates);
+			ImGui::Text("Uploaded %.1f KB", stats.TextureUploadBytes / 1024.0);
+
+			ImGui::Separator();
+			ImGui::SliderFloat("Zoom", &zoom, 0.5f, 4.0f, "%.2f");
+			if (!sweeping && ImGui::Button("Sweep Zoom"))
+			{
+				sweeping = true;
+				sweepTime = 0;
+			}
+			ImGui::SliderFloat("Big Text", &bigTextSize, 32, 400, "%.0f px");
+			ImGui::TextUnformatted("Run with --sdf to compare");
+		}
+		ImGui::End();
+
+		ImGui::SetNextWindowPos(ImVec2(380, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(880, 500), ImGuiCond_Once);
+		if (ImGui::Begin("Text Sizes", nullptr, ImGuiWindowFlags_HorizontalScrollbar))
+		{
+			// every size times the zoom is a size ImGui has to draw
+			for (float size : TextSizes)
+			{
+				ImGui::PushFont(nullptr, size * zoom);
+				ImGui::Text("%.0f px: The quick brown fox jumps over the lazy dog 0123456789", size * zoom);
+				ImGui::PopFont();
+			}
+		}
+		ImGui::End();
+
+		ImGui::SetNextWindowPos(ImVec2(380, 520), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(880, 270), ImGuiCond_Once);
+		if (ImGui::Begin("Edge Quality", nullptr, ImGuiWindowFlags_HorizontalScrollbar))
+		{
+			// large text shows the edges of scaled glyphs
+			ImGui::PushFont(nullptr, bigTextSize);
+			ImGui::TextUnformatted("Rag & Sw");
+			ImGui::PopFont();
+		}
+		ImGui::End();
+
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiShutdown();
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
@@ -0,0 +1,156 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Sprite Preview
+*
+*	This example shows animated previews from a sprite sheet, like the animation list of a tool
+*	The sheet works out the UVs of every frame once, so each preview only picks a frame and draws it.
+*	The window shows the time spent drawing all the previews.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <cmath>
+
+static constexpr int FrameSize = 32;
+static constexpr int FrameColumns = 8;
+static constexpr int AnimationCount = 4;
+static constexpr int PreviewCount = 400;
+
+// 4 animations of 8 frames, a ball that bounces, grows, spins and fades
+static Texture MakeSpriteSheet(void)
+{
+	Image sheet = GenImageColor(FrameSize * FrameColumns, FrameSize * AnimationCount, BLANK);
+	for (int frame = 0; frame < FrameColumns; frame++)
+	{
+		float t = frame / float(FrameColumns);
+		int x = frame * FrameSize;
+
+		int bounce = int(fabsf(sinf(t * PI)) * 16);
+		ImageDrawRectangle(&sheet, x + 10, 20 - bounce, 12, 12, RED);
+
+		int grow = 4 + frame * 3;
+		ImageDrawRectangle(&sheet, x + (FrameSize - grow) / 2, FrameSize + (FrameSize - grow) / 2, grow, grow, GREEN);
+
+		int spin = frame * 3;
+		ImageDrawRectangle(&sheet, x + spin, FrameSize * 2 + 2, 6, 28, SKYBLUE);
+
+		ImageDrawRectangle(&sheet, x + 6, FrameSize * 3 + 6, 20, 20, Fade(GOLD, 1.0f - t));
+	}
+
+	Texture texture = LoadTextureFromImage(sheet);
+	UnloadImage(sheet);
+	return texture;
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - sprite preview");
+	SetTargetFPS(144);
+	rlImGuiSetup(true);
+
+	Texture texture = MakeSpriteSheet();
+	rlImGuiSpriteSheet* sheet = rlImGuiCreateSpriteSheetGrid(&texture, FrameSize, FrameSize, 0);
+
+	bool flipX = false;
+	bool flipY = false;
+	float fps = 12;
+	float previewSize = 40;
+	double drawMs = 0;
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(300, 0), ImGuiCond_Once);
+		if (ImGui::Begin("Sprite Sheet", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			ImGui::Text("%d frames, %d previews", rlImGuiGetSpriteSheetFrameCount(sheet), PreviewCount);
+			ImGui::Text("Previews drawn in %.3f ms", drawMs);
+			ImGui::SliderFloat("FPS", &fps, 1, 60, "%.0f");
+			ImGui::SliderFloat("Size", &previewSize, 16, 96, "%.0f");
+			ImGui::Checkbox("Flip X", &flipX);
+			ImGui::SameLine();
+			ImGui::Checkbox("Flip Y", &flipY);
+
+			// every frame of the sheet, as buttons
+			ImGui::SeparatorText("Frames");
+			for (int i = 0; i < rlImGuiGetSpriteSheetFrameCount(sheet); i++)
+			{
+				if (i % FrameColumns != 0)
+					ImGui::SameLine();
+				ImGui::PushID(i);
+				rlImGuiSpriteButton("##Frame", sheet, i, Vector2{ 0, 0 });
+				ImGui::PopID();
+			}
+		}
+		ImGui::End();
+
+		ImGui::SetNextWindowPos(ImVec2(320, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(950, 780), ImGuiCond_Once);
+		if (ImGui::Begin("Previews"))
+		{
+			double start = GetTime();
+			double time = ImGui::GetTime();
+
+			float width = ImGui::GetContentRegionAvail().x;
+			float x = 0;
+			for (int i = 0; i < PreviewCount; i++)
+			{
+				if (x > 0 && x + previewSize <= width)
+					ImGui::SameLine();
+				else
+					x = 0;
+
+				// each preview starts at a different time so they are not all in step
+				int animation = i % AnimationCount;
+				int frame = rlImGuiGetSpriteAnimationFrame(animation * FrameColumns, FrameColumns, fps, time + i * 0.05, true);
+				rlImGuiSpriteEx(sheet, frame, Vector2{ previewSize, previewSize }, flipX, flipY, WHITE);
+
+				x += previewSize + ImGui::GetStyle().ItemSpacing.x;
+			}
+
+			drawMs = (GetTime() - start) * 1000.0;
+		}
+		ImGui::End();
+
+		// the simple form, timed by ImGui
+		ImGui::SetNextWindowPos(ImVec2(10, 400), ImGuiCond_Once);
+		if (ImGui::Begin("Bounce", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+			rlImGuiSpriteAnimated(sheet, 0, FrameColumns, fps, Vector2{ 128, 128 });
+		ImGui::End();
+
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	rlImGuiDestroySpriteSheet(sheet);
+	rlImGuiShutdown();
+	UnloadTexture(texture);
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
@@ -0,0 +1,170 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - Stream Texture
+*
+*	This example shows two streaming textures fed by producer threads
+*	The camera thread pushes 640x480 frames at a set rate, like a camera feed, and the generator thread writes 512x512
+*	frames in place as fast as it can, so most of its frames are dropped and only the newest is shown.
+*	Each window shows the frames pushed, uploaded and dropped, the upload rate and the latency.
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+struct Producer
+{
+	rlImGuiStreamTexture* Stream = nullptr;
+	int Width = 0;
+	int Height = 0;
+	std::atomic<int> FramesPerSecond{ 0 };  // 0 is as fast as it can
+	std::atomic<bool> Running{ true };
+	std::thread Thread;
+};
+
+// moving color bars, with a bar that sweeps across so dropped frames show as jumps
+static void DrawFrame(unsigned char* pixels, int width, int height, double time)
+{
+	int sweep = int(fmod(time * 200.0, double(width)));
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			unsigned char* pixel = pixels + (size_t(y) * width + x) * 4;
+			bool bar = x >= sweep && x < sweep + 8;
+			pixel[0] = bar ? 255 : (unsigned char)((x + int(time * 60)) & 0xFF);
+			pixel[1] = bar ? 255 : (unsigned char)((y + int(time * 30)) & 0xFF);
+			pixel[2] = bar ? 255 : (unsigned char)(128 + 127 * sin(time + x * 0.02));
+			pixel[3] = 255;
+		}
+	}
+}
+
+// pushes a copy of each frame, like a camera callback that owns its buffer
+static void RunCamera(Producer* producer)
+{
+	std::vector<unsigned char> frame(size_t(producer->Width) * producer->Height * 4);
+	while (producer->Running)
+	{
+		DrawFrame(frame.data(), producer->Width, producer->Height, GetTime());
+		rlImGuiPushStreamFrame(producer->Stream, frame.data());
+
+		int fps = producer->FramesPerSecond;
+		if (fps > 0)
+			WaitTime(1.0 / fps);
+	}
+}
+
+// writes each frame straight into the stream's buffer
+static void RunGenerator(Producer* producer)
+{
+	while (producer->Running)
+	{
+		void* frame = rlImGuiBeginStreamFrame(producer->Stream);
+		if (!frame)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		DrawFrame((unsigned char*)frame, producer->Width, producer->Height, GetTime());
+		rlImGuiEndStreamFrame(producer->Stream, frame);
+	}
+}
+
+static void ShowStream(const char* name, Producer& producer, bool rate)
+{
+	if (ImGui::Begin(name))
+	{
+		if (rate)
+		{
+			int fps = producer.FramesPerSecond;
+			if (ImGui::SliderInt("Frames per second", &fps, 1, 240))
+				producer.FramesPerSecond = fps;
+		}
+
+		rlImGuiStreamTextureStats stats;
+		rlImGuiGetStreamTextureStats(producer.Stream, &stats);
+		ImGui::Text("Pushed %u, uploaded %u, dropped %u, rejected %u", stats.Pushed, stats.Uploaded, stats.Dropped, stats.Rejected);
+		ImGui::Text("%.0f pushed/s, %.0f uploaded/s, %.1f MB/s", stats.PushedPerSecond, stats.UploadedPerSecond, stats.UploadMegabytesPerSecond);
+		ImGui::Text("Upload %.3f ms, latency %.2f ms, %d textures", stats.UploadMs, stats.LatencyMs, stats.Textures);
+
+		rlImGuiStreamImage(producer.Stream, Vector2{ 0, 0 });
+	}
+	ImGui::End();
+}
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - stream texture");
+	SetTargetFPS(144);
+	rlImGuiSetup(true);
+
+	Producer camera;
+	camera.Width = 640;
+	camera.Height = 480;
+	camera.FramesPerSecond = 30;
+	camera.Stream = rlImGuiCreateStreamTexture(camera.Width, camera.Height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 3);
+	camera.Thread = std::thread(RunCamera, &camera);
+
+	Producer generator;
+	generator.Width = 512;
+	generator.Height = 512;
+	generator.Stream = rlImGuiCreateStreamTexture(generator.Width, generator.Height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 3);
+	generator.Thread = std::thread(RunGenerator, &generator);
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		rlImGuiBegin();
+
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(640, 600), ImGuiCond_Once);
+		ShowStream("Camera", camera, true);
+
+		ImGui::SetNextWindowPos(ImVec2(660, 10), ImGuiCond_Once);
+		ImGui::SetNextWindowSize(ImVec2(600, 600), ImGuiCond_Once);
+		ShowStream("Generator", generator, false);
+
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, GetScreenHeight() - 30);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	// the producers stop before their streams are destroyed
+	for (Producer* producer : { &camera, &generator })
+	{
+		producer->Running = false;
+		producer->Thread.join();
+		rlImGuiDestroyStreamTexture(producer->Stream);
+	}
+
+	rlImGuiShutdown();
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
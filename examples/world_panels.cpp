@@ -0,0 +1,166 @@
+/*******************************************************************************************
+*
+*   raylib-extras [ImGui] example - World Panels
+*
+*	This example shows a wall of ImGui panels in a 3d scene
+*	Each panel has it's own context and render texture, and is clicked with a mouse ray
+*	Panels are only drawn when they change, and a budget limits how many draw each frame
+*
+*   Copyright (c) 2021 Jeffery Myers
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include "imgui.h"
+#include "rlImGui.h"
+
+static constexpr int WallColumns = 8;
+static constexpr int WallRows = 4;
+static constexpr int PanelCount = WallColumns * WallRows;
+
+struct PanelState
+{
+	rlImGuiWorldPanel* Panel = nullptr;
+	float Value = 0;
+	int Clicks = 0;
+	bool ShowsClock = false;
+	int LastSecond = -1;
+};
+
+int main(int argc, char* argv[])
+{
+	// Initialization
+	//--------------------------------------------------------------------------------------
+	int screenWidth = 1280;
+	int screenHeight = 800;
+
+	SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_VSYNC_HINT | FLAG_WINDOW_RESIZABLE);
+	InitWindow(screenWidth, screenHeight, "raylib-Extras [ImGui] example - world panels");
+	SetTargetFPS(144);
+	rlImGuiSetup(true);
+
+	Camera3D camera = { 0 };
+	camera.position = Vector3{ 0, 2, 9 };
+	camera.target = Vector3{ 0, 2, 0 };
+	camera.up = Vector3{ 0, 1, 0 };
+	camera.fovy = 45;
+	camera.projection = CAMERA_PERSPECTIVE;
+
+	// a curved wall of screens
+	PanelState panels[PanelCount];
+	for (int i = 0; i < PanelCount; i++)
+	{
+		int column = i % WallColumns;
+		int row = i / WallColumns;
+
+		PanelState& state = panels[i];
+		state.Panel = rlImGuiCreateWorldPanel(320, 240, true);
+		state.ShowsClock = (i % 3) == 0;
+
+		float angle = (column - (WallColumns - 1) * 0.5f) * 0.22f;
+		float radius = 8;
+		Vector3 center = { sinf(angle) * radius, 0.6f + row * 1.05f, -cosf(angle) * radius + 4 };
+		Vector3 right = { cosf(angle) * 0.65f, 0, sinf(angle) * 0.65f };
+		Vector3 up = { 0, 0.49f, 0 };
+
+		rlImGuiSetWorldPanelQuad(state.Panel,
+			Vector3Add(Vector3Subtract(center, right), up),
+			Vector3Subtract(Vector3Subtract(center, right), up),
+			Vector3Subtract(Vector3Add(center, right), up),
+			Vector3Add(Vector3Add(center, right), up));
+
+		// the clock panels do not need to update more than a few times a second
+		rlImGuiSetWorldPanelRefreshInterval(state.Panel, state.ShowsClock ? 0.25f : 0.0f);
+	}
+
+	int budget = 4;
+	rlImGuiSetWorldPanelBudget(budget);
+
+	// Main game loop
+	while (!WindowShouldClose())    // Detect window close button or ESC key
+	{
+		if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT))
+			UpdateCamera(&camera, CAMERA_THIRD_PERSON);
+
+		// send the mouse to the panels and pick the ones that draw this frame
+		rlImGuiUpdateWorldPanels(GetScreenToWorldRay(GetMousePosition(), camera));
+
+		for (int i = 0; i < PanelCount; i++)
+		{
+			PanelState& state = panels[i];
+
+			// content that changes on it's own has to mark the panel
+			int second = int(GetTime());
+			if (state.ShowsClock && second != state.LastSecond)
+			{
+				state.LastSecond = second;
+				rlImGuiMarkWorldPanelDirty(state.Panel);
+			}
+
+			if (!rlImGuiBeginWorldPanel(state.Panel))
+				continue;
+
+			ImGui::SetNextWindowPos(ImVec2(0, 0));
+			ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+			if (ImGui::Begin("Panel", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove))
+			{
+				ImGui::Text("Screen %d", i);
+				if (state.ShowsClock)
+					ImGui::Text("Uptime %d s", state.LastSecond);
+
+				ImGui::SliderFloat("Value", &state.Value, 0, 1);
+				if (ImGui::Button("Click"))
+					state.Clicks++;
+				ImGui::SameLine();
+				ImGui::Text("%d clicks", state.Clicks);
+				ImGui::ProgressBar(state.Value);
+			}
+			ImGui::End();
+
+			rlImGuiEndWorldPanel(state.Panel);
+		}
+
+		BeginDrawing();
+		ClearBackground(DARKGRAY);
+
+		BeginMode3D(camera);
+		DrawGrid(20, 1);
+		for (const PanelState& state : panels)
+			rlImGuiDrawWorldPanel(state.Panel, rlImGuiIsWorldPanelHovered(state.Panel) ? WHITE : LIGHTGRAY);
+		EndMode3D();
+
+		rlImGuiBegin();
+		ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Once);
+		if (ImGui::Begin("World Panels"))
+		{
+			if (ImGui::SliderInt("Budget", &budget, 0, PanelCount))
+				rlImGuiSetWorldPanelBudget(budget);
+
+			rlImGuiWorldPanelStats stats;
+			rlImGuiGetWorldPanelStats(&stats);
+			ImGui::Text("Panels %d", stats.PanelCount);
+			ImGui::Text("Wanted to draw %d, drawn %d", stats.ReadyCount, stats.ScheduledCount);
+			ImGui::Text("Total panel draws %u", stats.RefreshCount);
+			ImGui::TextUnformatted("Right drag to move the camera");
+		}
+		ImGui::End();
+		rlImGuiEnd();
+
+		DrawFPS(GetScreenWidth() - 100, 10);
+
+		EndDrawing();
+		//----------------------------------------------------------------------------------
+	}
+
+	// De-Initialization
+	//--------------------------------------------------------------------------------------
+	for (PanelState& state : panels)
+		rlImGuiDestroyWorldPanel(state.Panel);
+	rlImGuiShutdown();
+	CloseWindow();        // Close window and OpenGL context
+	//--------------------------------------------------------------------------------------
+
+	return 0;
+}
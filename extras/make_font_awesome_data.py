@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+#
+# Makes the uncompressed Font Awesome data used when rlImGui is built with RLIMGUI_FA_RAW_DATA.
+#
+# The font is read from FA6FreeSolidFontData.h (stb compressed) and written as
+#   FA6FreeSolidFontRawData.h   a byte array header (the default)
+#   a .ttf file and a header that uses #embed on it (--embed), for compilers that support #embed
+#
+# The font can be cut down to a list of icons with --icons (needs fontTools: pip install fonttools).
+# Icon names are the ICON_FA_ names from IconsFontAwesome6.h, with or without the ICON_FA_ prefix.
+#
+#   python3 make_font_awesome_data.py
+#   python3 make_font_awesome_data.py --icons ICON_FA_FLOPPY_DISK,ICON_FA_FOLDER_OPEN
+#   python3 make_font_awesome_data.py --icons-file used_icons.txt --embed
+#
+# The sizes of the compressed, raw and subset data are printed so the variants can be compared.
+
+import argparse
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def read_compressed_header(path):
+    with open(path, "r") as f:
+        text = f.read()
+    start = text.index("fa_solid_900_compressed_data[]")
+    start = text.index("{", start)
+    end = text.index("}", start)
+    return bytes(int(value, 16) for value in re.findall(r"0x([0-9A-Fa-f]{2})", text[start:end]))
+
+
+def stb_decompress(data):
+    # the decompressor from stb.h, the format used by imgui's binary_to_compressed_c
+    def in2(i):
+        return (data[i] << 8) + data[i + 1]
+
+    def in3(i):
+        return (data[i] << 16) + in2(i + 1)
+
+    def in4(i):
+        return (data[i] << 24) + in3(i + 1)
+
+    if in4(0) != 0x57BC0000 or in4(4) != 0:
+        raise ValueError("not stb compressed data")
+
+    length = in4(8)
+    out = bytearray()
+
+    def match(distance, count):
+        start = len(out) - distance
+        for n in range(count):
+            out.append(out[start + n])
+
+    def literal(at, count):
+        out.extend(data[at:at + count])
+
+    i = 16
+    while True:
+        c = data[i]
+        if c >= 0x80:
+            match(data[i + 1] + 1, c - 0x80 + 1)
+            i += 2
+        elif c >= 0x40:
+            match(in2(i) - 0x4000 + 1, data[i + 2] + 1)
+            i += 3
+        elif c >= 0x20:
+            count = c - 0x20 + 1
+            literal(i + 1, count)
+            i += 1 + count
+        elif c >= 0x18:
+            match(in3(i) - 0x180000 + 1, data[i + 3] + 1)
+            i += 4
+        elif c >= 0x10:
+            match(in3(i) - 0x100000 + 1, in2(i + 3) + 1)
+            i += 5
+        elif c >= 0x08:
+            count = in2(i) - 0x0800 + 1
+            literal(i + 2, count)
+            i += 2 + count
+        elif c == 0x07:
+            count = in2(i + 1) + 1
+            literal(i + 3, count)
+            i += 3 + count
+        elif c == 0x06:
+            match(in3(i + 1) + 1, data[i + 4] + 1)
+            i += 5
+        elif c == 0x04:
+            match(in3(i + 1) + 1, in2(i + 4) + 1)
+            i += 6
+        elif c == 0x05 and data[i + 1] == 0xFA:
+            break
+        else:
+            raise ValueError("bad stb compressed data at %d" % i)
+
+    if len(out) != length:
+        raise ValueError("decompressed %d bytes, expected %d" % (len(out), length))
+    return bytes(out)
+
+
+def read_icon_codepoints(names):
+    icons = {}
+    with open(os.path.join(HERE, "IconsFontAwesome6.h"), "r") as f:
+        for line in f:
+            found = re.match(r"#define (ICON_FA_\w+) .*// U\+([0-9a-fA-F]+)", line)
+            if found:
+                icons[found.group(1)] = int(found.group(2), 16)
+
+    codepoints = []
+    for name in names:
+        key = name if name.startswith("ICON_FA_") else "ICON_FA_" + name
+        if key not in icons:
+            sys.exit("unknown icon " + name)
+        codepoints.append(icons[key])
+    return codepoints
+
+
+def subset_font(ttf, codepoints):
+    try:
+        from fontTools import subset
+        from fontTools.ttLib import TTFont
+    except ImportError:
+        sys.exit("--icons needs fontTools, install it with: pip install fonttools")
+
+    import io
+    font = TTFont(io.BytesIO(ttf))
+    options = subset.Options()
+    options.layout_features = []
+    options.name_IDs = []
+    options.notdef_outline = True
+    subsetter = subset.Subsetter(options)
+    subsetter.populate(unicodes=codepoints)
+    subsetter.subset(font)
+
+    out = io.BytesIO()
+    font.save(out)
+    return out.getvalue()
+
+
+def write_array_header(path, ttf, note):
+    with open(path, "w") as f:
+        f.write("// File: 'fa-solid-900.ttf' (%d bytes)%s\n" % (len(ttf), note))
+        f.write("// Made by make_font_awesome_data.py, used when building with RLIMGUI_FA_RAW_DATA\n\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write("static const unsigned int fa_solid_900_raw_size = %d;\n" % len(ttf))
+        f.write("static const uint8_t fa_solid_900_raw_data[] = {\n")
+        for at in range(0, len(ttf), 16):
+            f.write(" " + " ".join("0x%02X," % b for b in ttf[at:at + 16]) + "\n")
+        f.write("};\n")
+
+
+def write_embed_header(path, ttf_name, ttf, note):
+    with open(path, "w") as f:
+        f.write("// File: '%s' (%d bytes)%s\n" % (ttf_name, len(ttf), note))
+        f.write("// Made by make_font_awesome_data.py, used when building with RLIMGUI_FA_RAW_DATA\n\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write("#if !defined(__has_embed)\n")
+        f.write("#error \"This compiler does not support #embed, run make_font_awesome_data.py without --embed\"\n")
+        f.write("#endif\n\n")
+        f.write("static const uint8_t fa_solid_900_raw_data[] = {\n")
+        f.write("#embed \"%s\"\n" % ttf_name)
+        f.write("};\n")
+        f.write("static const unsigned int fa_solid_900_raw_size = sizeof(fa_solid_900_raw_data);\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Make uncompressed Font Awesome data for rlImGui")
+    parser.add_argument("--icons", help="comma separated list of icons to keep")
+    parser.add_argument("--icons-file", help="file with one icon name per line to keep")
+    parser.add_argument("--embed", action="store_true", help="write a .ttf and a header that uses #embed")
+    parser.add_argument("--out", default=os.path.join(HERE, "FA6FreeSolidFontRawData.h"), help="header to write")
+    args = parser.parse_args()
+
+    compressed = read_compressed_header(os.path.join(HERE, "FA6FreeSolidFontData.h"))
+    ttf = stb_decompress(compressed)
+    print("compressed   %8d bytes" % len(compressed))
+    print("raw          %8d bytes" % len(ttf))
+
+    names = []
+    if args.icons:
+        names += [name.strip() for name in args.icons.split(",") if name.strip()]
+    if args.icons_file:
+        with open(args.icons_file, "r") as f:
+            names += [line.strip() for line in f if line.strip() and not line.startswith("#")]
+
+    note = ""
+    if names:
+        ttf = subset_font(ttf, read_icon_codepoints(names))
+        note = ", subset to %d icons" % len(names)
+        print("subset       %8d bytes (%d icons)" % (len(ttf), len(names)))
+
+    if args.embed:
+        ttf_name = "fa-solid-900.ttf"
+        with open(os.path.join(os.path.dirname(os.path.abspath(args.out)), ttf_name), "wb") as f:
+            f.write(ttf)
+        write_embed_header(args.out, ttf_name, ttf, note)
+    else:
+        write_array_header(args.out, ttf, note)
+
+    print("wrote " + args.out)
+
+
+if __name__ == "__main__":
+    main()
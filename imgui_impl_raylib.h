@@ -47,4 +47,8 @@ IMGUI_IMPL_API void ImGui_ImplRaylib_NewFrame(void);
 IMGUI_IMPL_API void ImGui_ImplRaylib_RenderDrawData(ImDrawData* draw_data);
 IMGUI_IMPL_API bool ImGui_ImplRaylib_ProcessEvents(void);
 
+// key translation, raylib key codes are the same as GLFW key codes
+IMGUI_IMPL_API ImGuiKey ImGui_ImplRaylib_KeyToImGuiKey(int key);
+IMGUI_IMPL_API int ImGui_ImplRaylib_ImGuiKeyToKey(ImGuiKey key);
+
 #endif // #ifndef IMGUI_DISABLE
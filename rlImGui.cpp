@@ -31,906 +31,7432 @@
 #include "rlgl.h"
 
 #include "imgui.h"
+#include "imgui_internal.h"
 
 #include <math.h>
 #include <limits>
 #include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RLIMGUI_FONT_CACHE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(RLIMGUI_GLFW_EVENTS)
+#define GLFW_INCLUDE_NONE
+#include "GLFW/glfw3.h"
+#endif
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__) && !defined(RLIMGUI_NO_THREADS)
+#define RLIMGUI_NO_THREADS
+#endif
+
+#include <atomic>
+#if !defined(RLIMGUI_NO_THREADS)
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#if !defined(RLIMGUI_NO_SDF_FONTS)
+// a private copy of stb_truetype for the distance field glyphs, imgui and raylib keep their copies static as well
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#define STBTT_malloc(x, u) ((void)(u), IM_ALLOC(x))
+#define STBTT_free(x, u) ((void)(u), IM_FREE(x))
+#include "imstb_truetype.h"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+#endif
 
 #ifndef NO_FONT_AWESOME
+#if defined(RLIMGUI_FA_RAW_DATA)
+// uncompressed font made by extras/make_font_awesome_data.py
+#include "extras/FA6FreeSolidFontRawData.h"
+#else
 #include "extras/FA6FreeSolidFontData.h"
 #endif
+#endif
 
-static ImGuiMouseCursor CurrentMouseCursor = ImGuiMouseCursor_COUNT;
 static MouseCursor MouseCursorMap[ImGuiMouseCursor_COUNT];
 
 ImGuiContext* GlobalContext = nullptr;
 
-static constexpr size_t MAX_RAYLIB_KEY = 349;
-static ImGuiKey RaylibKeyMap[MAX_RAYLIB_KEY];
-static bool KeyMapInitialized = false;
+// the context between a begin and end call, the rlImGui image functions draw into it
+static ImGuiContext* FrameContext = nullptr;
 
-static bool LastFrameFocused = false;
+static void SetFrameContext(void)
+{
+    if (FrameContext)
+        ImGui::SetCurrentContext(FrameContext);
+    else if (GlobalContext)
+        ImGui::SetCurrentContext(GlobalContext);
+}
 
-static bool LastControlPressed = false;
-static bool LastShiftPressed = false;
-static bool LastAltPressed = false;
-static bool LastSuperPressed = false;
+// optional disk cache for the font atlas.
+// ImGui bakes glyphs on demand for each font size, so the cache stores each baked glyph (metrics and alpha pixels) keyed by
+// a hash of the font data and config, the baked size and the rasterizer density. A loader that wraps the normal font loader
+// copies cached glyphs into the atlas and only rasterizes the ones that are missing.
+// The file is checked against the ImGui version and memory mapped where it can be.
+static constexpr char FontCacheMagic[4] = { 'R', 'I', 'F', 'C' };
+static constexpr unsigned int FontCacheVersion = 1;
 
-// internal only functions
-bool rlImGuiIsControlDown() { return IsKeyDown(KEY_RIGHT_CONTROL) || IsKeyDown(KEY_LEFT_CONTROL); }
-bool rlImGuiIsShiftDown() { return IsKeyDown(KEY_RIGHT_SHIFT) || IsKeyDown(KEY_LEFT_SHIFT); }
-bool rlImGuiIsAltDown() { return IsKeyDown(KEY_RIGHT_ALT) || IsKeyDown(KEY_LEFT_ALT); }
-bool rlImGuiIsSuperDown() { return IsKeyDown(KEY_RIGHT_SUPER) || IsKeyDown(KEY_LEFT_SUPER); }
+enum FontCacheGlyphFlags
+{
+    FontCacheGlyph_Found = 1 << 0,      // the font has this glyph, if not set the loader returns false for it
+    FontCacheGlyph_Visible = 1 << 1,    // the glyph has pixels
+};
 
-struct ImGui_ImplRaylib_Data
+struct FontCacheHeader
 {
+    char Magic[4];
+    unsigned int Version;
+    unsigned int ImGuiVersion;
+    unsigned int GlyphCount;
+    unsigned int BlobCount;
+    unsigned int PixelBytes;
+    unsigned int BlobBytes;
 };
 
-ImGui_ImplRaylib_Data* ImGui_ImplRaylib_GetBackendData()
+struct FontCacheGlyph
 {
-    return ImGui::GetCurrentContext() ? static_cast<ImGui_ImplRaylib_Data*>(ImGui::GetPlatformIO().Renderer_RenderState) : nullptr;
-}
+    ImGuiID SourceHash;
+    float Size;
+    float Density;
+    unsigned int Codepoint;
+    unsigned int Flags;
+    float AdvanceX;
+    float X0, Y0, X1, Y1;
+    unsigned short Width, Height;
+    unsigned int PixelOffset;
+};
 
-void ImGui_ImplRaylib_CreateBackendData()
+// raw font data that is expensive to make, such as a decompressed TTF
+struct FontCacheBlob
 {
-    if (!ImGui::GetCurrentContext() || ImGui::GetPlatformIO().Renderer_RenderState)
-        return;
+    ImGuiID Key;
+    unsigned int Size;
+    unsigned int Offset;
+};
 
-    ImGui::GetPlatformIO().Renderer_RenderState = MemAlloc(sizeof(ImGui_ImplRaylib_Data));
-}
+struct FontCacheSource
+{
+    const ImFontConfig* Config;
+    ImGuiID Hash;
+};
 
-void ImGui_ImplRaylib_FreeBackendData()
+struct FontCache
 {
-    if (!ImGui::GetCurrentContext())
-        return;
+    char* FileName = nullptr;
+
+    // the loaded file, glyphs from it point into this data
+    unsigned char* FileData = nullptr;
+    size_t FileSize = 0;
+    bool Mapped = false;
+    const FontCacheHeader* Header = nullptr;
+    const FontCacheGlyph* Glyphs = nullptr;
+    const FontCacheBlob* Blobs = nullptr;
+    const unsigned char* Pixels = nullptr;
+    const unsigned char* BlobData = nullptr;
+
+    // glyphs made this run, saved with the ones from the file
+    ImVector<FontCacheGlyph> NewGlyphs;
+    ImVector<unsigned char> NewPixels;
+    ImVector<FontCacheBlob> NewBlobs;
+    ImVector<unsigned char> NewBlobData;
+
+    ImGuiStorage Lookup;    // glyph key to glyph index + 1, indexes past the file glyphs are new glyphs
+    ImVector<FontCacheSource> Sources;
+
+    const ImFontLoader* Loader = nullptr;
+    rlImGuiFontCacheStats Stats = {};
+};
+
+static FontCache* ActiveFontCache = nullptr;
+static ImFontLoader CachedFontLoader;
 
-    MemFree(ImGui::GetPlatformIO().Renderer_RenderState);
+static ImGuiID FontCacheGlyphKey(ImGuiID sourceHash, float size, float density, unsigned int codepoint)
+{
+    struct { ImGuiID Source; float Size; float Density; unsigned int Codepoint; } key = { sourceHash, size, density, codepoint };
+    return ImHashData(&key, sizeof(key));
 }
 
+static unsigned int FontCacheFileGlyphCount(const FontCache* cache)
+{
+    return cache->Header ? cache->Header->GlyphCount : 0;
+}
 
-Vector2 GetDisplayScale()
+static void UnmapFontCacheFile(FontCache* cache)
 {
-#if defined(__EMSCRIPTEN__)
-    return Vector2{ 1,1 };
-#else
-    return GetWindowScaleDPI();
+    if (!cache->FileData)
+        return;
+
+#if defined(RLIMGUI_FONT_CACHE_MMAP)
+    if (cache->Mapped)
+        munmap(cache->FileData, cache->FileSize);
+    else
 #endif
+        UnloadFileData(cache->FileData);
+
+    cache->FileData = nullptr;
+    cache->FileSize = 0;
+    cache->Mapped = false;
+    cache->Header = nullptr;
 }
 
-static const char* GetClipTextCallback(ImGuiContext*)
+static bool MapFontCacheFile(FontCache* cache)
 {
-    return GetClipboardText();
+#if defined(RLIMGUI_FONT_CACHE_MMAP)
+    int file = open(cache->FileName, O_RDONLY);
+    if (file >= 0)
+    {
+        struct stat info;
+        if (fstat(file, &info) == 0 && info.st_size > 0)
+        {
+            void* data = mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            if (data != MAP_FAILED)
+            {
+                cache->FileData = (unsigned char*)data;
+                cache->FileSize = size_t(info.st_size);
+                cache->Mapped = true;
+            }
+        }
+        close(file);
+    }
+#endif
+
+    if (!cache->FileData && FileExists(cache->FileName))
+    {
+        int dataSize = 0;
+        cache->FileData = LoadFileData(cache->FileName, &dataSize);
+        cache->FileSize = cache->FileData ? size_t(dataSize) : 0;
+    }
+
+    if (!cache->FileData)
+        return false;
+
+    const FontCacheHeader* header = (const FontCacheHeader*)cache->FileData;
+    bool valid = cache->FileSize >= sizeof(FontCacheHeader) && memcmp(header->Magic, FontCacheMagic, sizeof(header->Magic)) == 0
+        && header->Version == FontCacheVersion && header->ImGuiVersion == IMGUI_VERSION_NUM;
+
+    size_t glyphBytes = valid ? size_t(header->GlyphCount) * sizeof(FontCacheGlyph) : 0;
+    size_t blobBytes = valid ? size_t(header->BlobCount) * sizeof(FontCacheBlob) : 0;
+    if (!valid || cache->FileSize < sizeof(FontCacheHeader) + glyphBytes + blobBytes + header->PixelBytes + header->BlobBytes)
+    {
+        // an old or broken cache is replaced when the cache is saved
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Font cache is out of date or invalid, it will be rebuilt", cache->FileName);
+        UnmapFontCacheFile(cache);
+        return false;
+    }
+
+    cache->Header = header;
+    cache->Glyphs = (const FontCacheGlyph*)(cache->FileData + sizeof(FontCacheHeader));
+    cache->Blobs = (const FontCacheBlob*)(cache->FileData + sizeof(FontCacheHeader) + glyphBytes);
+    cache->Pixels = cache->FileData + sizeof(FontCacheHeader) + glyphBytes + blobBytes;
+    cache->BlobData = cache->Pixels + header->PixelBytes;
+
+    // the lookup is built in one go and sorted once
+    cache->Lookup.Data.reserve(int(header->GlyphCount));
+    for (unsigned int i = 0; i < header->GlyphCount; i++)
+    {
+        const FontCacheGlyph& glyph = cache->Glyphs[i];
+        bool inRange = !(glyph.Flags & FontCacheGlyph_Visible) || size_t(glyph.PixelOffset) + size_t(glyph.Width) * glyph.Height <= header->PixelBytes;
+        if (inRange)
+            cache->Lookup.Data.push_back(ImGuiStoragePair(FontCacheGlyphKey(glyph.SourceHash, glyph.Size, glyph.Density, glyph.Codepoint), int(i + 1)));
+    }
+    cache->Lookup.BuildSortByKey();
+
+    cache->Stats.FileGlyphs = int(header->GlyphCount);
+    cache->Stats.FileBytes = (long long)cache->FileSize;
+    cache->Stats.Mapped = cache->Mapped;
+    return true;
 }
 
-static void SetClipTextCallback(ImGuiContext*, const char* text)
+static void DestroyFontCache(void)
 {
-    SetClipboardText(text);
+    if (!ActiveFontCache)
+        return;
+
+    UnmapFontCacheFile(ActiveFontCache);
+    MemFree(ActiveFontCache->FileName);
+    IM_DELETE(ActiveFontCache);
+    ActiveFontCache = nullptr;
 }
 
-static void ImGuiNewFrame(float deltaTime)
+static ImGuiID FindFontCacheSource(FontCache* cache, const ImFontConfig* src)
 {
-    ImGuiIO& io = ImGui::GetIO();
-    auto* platData = ImGui_ImplRaylib_GetBackendData();
-    if (!platData)
+    for (const FontCacheSource& source : cache->Sources)
     {
-        ImGui_ImplRaylib_CreateBackendData();
-        platData = ImGui_ImplRaylib_GetBackendData();
-        if (!platData)
-            return;
+        if (source.Config == src)
+            return source.Hash;
     }
+    return 0;
+}
 
-    Vector2 resolutionScale = GetDisplayScale();
+static const FontCacheGlyph* FindCachedGlyph(FontCache* cache, ImGuiID sourceHash, float size, float density, unsigned int codepoint, const unsigned char** pixels)
+{
+    int index = cache->Lookup.GetInt(FontCacheGlyphKey(sourceHash, size, density, codepoint), 0) - 1;
+    if (index < 0)
+        return nullptr;
 
-#ifndef PLATFORM_DRM
-    if (IsWindowFullscreen())
+    unsigned int fileGlyphs = FontCacheFileGlyphCount(cache);
+    const FontCacheGlyph* glyph = nullptr;
+    if (unsigned(index) < fileGlyphs)
     {
-        int monitor = GetCurrentMonitor();
-        io.DisplaySize.x = float(GetMonitorWidth(monitor));
-        io.DisplaySize.y = float(GetMonitorHeight(monitor));
+        glyph = &cache->Glyphs[index];
+        *pixels = cache->Pixels + glyph->PixelOffset;
     }
     else
     {
-        io.DisplaySize.x = float(GetScreenWidth());
-        io.DisplaySize.y = float(GetScreenHeight());
+        glyph = &cache->NewGlyphs[index - int(fileGlyphs)];
+        *pixels = cache->NewPixels.Data + glyph->PixelOffset;
     }
 
-#if !defined(__APPLE__)
-    if (!IsWindowState(FLAG_WINDOW_HIGHDPI))
-        resolutionScale = Vector2{ 1,1 };
-#endif
-#else
-    io.DisplaySize.x = float(GetScreenWidth());
-    io.DisplaySize.y = float(GetScreenHeight());
-#endif
-
-    io.DisplayFramebufferScale = ImVec2(resolutionScale.x, resolutionScale.y);
+    // guard against key collisions
+    if (glyph->SourceHash != sourceHash || glyph->Size != size || glyph->Density != density || glyph->Codepoint != codepoint)
+        return nullptr;
 
-    if (deltaTime <= 0)
-        deltaTime = 0.001f;
+    return glyph;
+}
 
-    io.DeltaTime = deltaTime;
+static void AddCachedGlyph(FontCache* cache, const FontCacheGlyph& glyph)
+{
+    cache->NewGlyphs.push_back(glyph);
+    cache->Lookup.SetInt(FontCacheGlyphKey(glyph.SourceHash, glyph.Size, glyph.Density, glyph.Codepoint), int(FontCacheFileGlyphCount(cache)) + cache->NewGlyphs.Size);
+    cache->Stats.NewGlyphs++;
+}
 
-    if (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_HasMouseCursors)
+static const void* FindFontCacheBlob(FontCache* cache, ImGuiID key, int* size)
+{
+    unsigned int blobCount = cache->Header ? cache->Header->BlobCount : 0;
+    for (unsigned int i = 0; i < blobCount; i++)
     {
-        if ((io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange) == 0)
+        if (cache->Blobs[i].Key == key && size_t(cache->Blobs[i].Offset) + cache->Blobs[i].Size <= cache->Header->BlobBytes)
         {
-            ImGuiMouseCursor imgui_cursor = ImGui::GetMouseCursor();
-            if (imgui_cursor != CurrentMouseCursor || io.MouseDrawCursor)
-            {
-                CurrentMouseCursor = imgui_cursor;
-                if (io.MouseDrawCursor || imgui_cursor == ImGuiMouseCursor_None)
-                {
-                    HideCursor();
-                }
-                else
-                {
-                    ShowCursor();
-
-                    if (!(io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange))
-                    {
-                        SetMouseCursor((imgui_cursor > -1 && imgui_cursor < ImGuiMouseCursor_COUNT) ? MouseCursorMap[imgui_cursor] : MOUSE_CURSOR_DEFAULT);
-                    }
-                }
-            }
+            *size = int(cache->Blobs[i].Size);
+            return cache->BlobData + cache->Blobs[i].Offset;
         }
     }
+    return nullptr;
 }
 
-static void ImGuiTriangleVert(const ImDrawVert& idx_vert)
+static void AddFontCacheBlob(FontCache* cache, ImGuiID key, const void* data, int size)
 {
-#ifdef __cpp_designated_initializers
-    Color c {
-       .r = static_cast<unsigned char>(idx_vert.col>>0),
-       .g = static_cast<unsigned char>(idx_vert.col>>8),
-       .b = static_cast<unsigned char>(idx_vert.col>>16),
-       .a = static_cast<unsigned char>(idx_vert.col>>24),
-    };
-#else
-    Color c {
-       static_cast<unsigned char>(idx_vert.col>>0),
-       static_cast<unsigned char>(idx_vert.col>>8),
-       static_cast<unsigned char>(idx_vert.col>>16),
-       static_cast<unsigned char>(idx_vert.col>>24),
-    };
-#endif
-    rlColor4ub(c.r, c.g, c.b, c.a);
-    rlTexCoord2f(idx_vert.uv.x, idx_vert.uv.y);
-    rlVertex2f(idx_vert.pos.x, idx_vert.pos.y);
+    FontCacheBlob blob = { key, unsigned(size), unsigned(cache->NewBlobData.Size) };
+    cache->NewBlobs.push_back(blob);
+    cache->NewBlobData.resize(cache->NewBlobData.Size + size);
+    memcpy(cache->NewBlobData.Data + blob.Offset, data, size);
 }
 
-static void ImGuiRenderTriangles(unsigned int count, int indexStart, const ImVector<ImDrawIdx>& indexBuffer, const ImVector<ImDrawVert>& vertBuffer, ImTextureID texturePtr)
+// the wrapping loader, everything but glyph loading goes to the real loader
+static bool CachedLoaderInit(ImFontAtlas* atlas)
 {
-    if (count < 3)
-        return;
+    const ImFontLoader* loader = ActiveFontCache->Loader;
+    return loader->LoaderInit ? loader->LoaderInit(atlas) : true;
+}
 
-    unsigned int textureId = static_cast<unsigned int>(texturePtr);
+static void CachedLoaderShutdown(ImFontAtlas* atlas)
+{
+    const ImFontLoader* loader = ActiveFontCache->Loader;
+    if (loader->LoaderShutdown)
+        loader->LoaderShutdown(atlas);
+}
 
-    rlBegin(RL_TRIANGLES);
-    rlSetTexture(textureId);
+static bool CachedFontSrcInit(ImFontAtlas* atlas, ImFontConfig* src)
+{
+    const ImFontLoader* loader = ActiveFontCache->Loader;
+    if (loader->FontSrcInit && !loader->FontSrcInit(atlas, src))
+        return false;
 
-    for (unsigned int i = 0; i <= (count - 3); i += 3)
+    // everything in the config that changes the baked glyphs
+    struct SourceKey
     {
-        ImDrawIdx indexA = indexBuffer[indexStart + i];
-        ImDrawIdx indexB = indexBuffer[indexStart + i + 1];
-        ImDrawIdx indexC = indexBuffer[indexStart + i + 2];
-
-        ImDrawVert vertexA = vertBuffer[indexA];
-        ImDrawVert vertexB = vertBuffer[indexB];
-        ImDrawVert vertexC = vertBuffer[indexC];
-
-        ImGuiTriangleVert(vertexA);
-        ImGuiTriangleVert(vertexB);
-        ImGuiTriangleVert(vertexC);
-    }
-    rlEnd();
+        ImGuiID DataHash;
+        int FontNo;
+        float SizePixels;
+        float RasterizerMultiply;
+        float RasterizerDensity;
+        float GlyphOffsetX, GlyphOffsetY;
+        float GlyphMinAdvanceX, GlyphMaxAdvanceX, GlyphExtraAdvanceX;
+        unsigned int FontLoaderFlags;
+        int OversampleH, OversampleV;
+        int PixelSnapH;
+    } key;
+    memset(&key, 0, sizeof(key));
+    key.DataHash = ImHashData(src->FontData, size_t(src->FontDataSize));
+    key.FontNo = src->FontNo;
+    key.SizePixels = src->SizePixels;
+    key.RasterizerMultiply = src->RasterizerMultiply;
+    key.RasterizerDensity = src->RasterizerDensity;
+    key.GlyphOffsetX = src->GlyphOffset.x;
+    key.GlyphOffsetY = src->GlyphOffset.y;
+    key.GlyphMinAdvanceX = src->GlyphMinAdvanceX;
+    key.GlyphMaxAdvanceX = src->GlyphMaxAdvanceX;
+    key.GlyphExtraAdvanceX = src->GlyphExtraAdvanceX;
+    key.FontLoaderFlags = src->FontLoaderFlags;
+    key.OversampleH = src->OversampleH;
+    key.OversampleV = src->OversampleV;
+    key.PixelSnapH = src->PixelSnapH ? 1 : 0;
+
+    // the loader is part of the hash, distance field glyphs and normal glyphs are different pixels
+    ImGuiID seed = ImHashStr(loader->Name ? loader->Name : "", 0, ImGuiID(IMGUI_VERSION_NUM));
+    FontCacheSource source = { src, ImHashData(&key, sizeof(key), seed) };
+    ActiveFontCache->Sources.push_back(source);
+    return true;
 }
 
-static void EnableScissor(float x, float y, float width, float height)
+static void CachedFontSrcDestroy(ImFontAtlas* atlas, ImFontConfig* src)
 {
-    rlEnableScissorTest();
-    ImGuiIO& io = ImGui::GetIO();
-
-    ImVec2 scale = io.DisplayFramebufferScale;
-#if !defined(__APPLE__)
-    if (!IsWindowState(FLAG_WINDOW_HIGHDPI))
+    FontCache* cache = ActiveFontCache;
+    for (int i = 0; i < cache->Sources.Size; i++)
     {
-        scale.x = 1;
-        scale.y = 1;
+        if (cache->Sources[i].Config == src)
+        {
+            cache->Sources.erase_unsorted(cache->Sources.Data + i);
+            break;
+        }
     }
-#endif
 
-    rlScissor((int)(x * scale.x),
-        int((io.DisplaySize.y - (int)(y + height)) * scale.y),
-        (int)(width * scale.x),
-        (int)(height * scale.y));
+    if (cache->Loader->FontSrcDestroy)
+        cache->Loader->FontSrcDestroy(atlas, src);
 }
 
-static void SetupMouseCursors(void)
+static bool CachedFontSrcContainsGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImWchar codepoint)
 {
-    MouseCursorMap[ImGuiMouseCursor_Arrow] = MOUSE_CURSOR_ARROW;
-    MouseCursorMap[ImGuiMouseCursor_TextInput] = MOUSE_CURSOR_IBEAM;
-    MouseCursorMap[ImGuiMouseCursor_Hand] = MOUSE_CURSOR_POINTING_HAND;
-    MouseCursorMap[ImGuiMouseCursor_ResizeAll] = MOUSE_CURSOR_RESIZE_ALL;
-    MouseCursorMap[ImGuiMouseCursor_ResizeEW] = MOUSE_CURSOR_RESIZE_EW;
-    MouseCursorMap[ImGuiMouseCursor_ResizeNESW] = MOUSE_CURSOR_RESIZE_NESW;
-    MouseCursorMap[ImGuiMouseCursor_ResizeNS] = MOUSE_CURSOR_RESIZE_NS;
-    MouseCursorMap[ImGuiMouseCursor_ResizeNWSE] = MOUSE_CURSOR_RESIZE_NWSE;
-    MouseCursorMap[ImGuiMouseCursor_NotAllowed] = MOUSE_CURSOR_NOT_ALLOWED;
+    const ImFontLoader* loader = ActiveFontCache->Loader;
+    return loader->FontSrcContainsGlyph ? loader->FontSrcContainsGlyph(atlas, src, codepoint) : true;
 }
 
-void SetupFontAwesome(void)
+static bool CachedFontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loaderData)
 {
-#ifndef NO_FONT_AWESOME
-    static const ImWchar icons_ranges[] = { ICON_MIN_FA, ICON_MAX_FA, 0 };
-    ImFontConfig icons_config;
-    icons_config.MergeMode = true;
-    icons_config.PixelSnapH = true;
-    icons_config.FontDataOwnedByAtlas = false;
+    const ImFontLoader* loader = ActiveFontCache->Loader;
+    return loader->FontBakedInit ? loader->FontBakedInit(atlas, src, baked, loaderData) : true;
+}
 
-    icons_config.GlyphMaxAdvanceX = std::numeric_limits<float>::max();
-    icons_config.RasterizerMultiply = 1.0f;
-    icons_config.OversampleH = 2;
-    icons_config.OversampleV = 1;
+static void CachedFontBakedDestroy(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loaderData)
+{
+    const ImFontLoader* loader = ActiveFontCache->Loader;
+    if (loader->FontBakedDestroy)
+        loader->FontBakedDestroy(atlas, src, baked, loaderData);
+}
 
-    icons_config.GlyphRanges = icons_ranges;
+static bool CachedFontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loaderData, ImWchar codepoint, ImFontGlyph* outGlyph, float* outAdvanceX)
+{
+    FontCache* cache = ActiveFontCache;
+    ImGuiID sourceHash = FindFontCacheSource(cache, src);
 
-    ImGuiIO& io = ImGui::GetIO();
+    const unsigned char* pixels = nullptr;
+    const FontCacheGlyph* cached = FindCachedGlyph(cache, sourceHash, baked->Size, baked->RasterizerDensity, codepoint, &pixels);
+    if (cached)
+    {
+        cache->Stats.Hits++;
+        if (!(cached->Flags & FontCacheGlyph_Found))
+            return false;
+
+        if (outAdvanceX)
+            *outAdvanceX = cached->AdvanceX;
+        if (!outGlyph)
+            return true;
+
+        outGlyph->Codepoint = codepoint;
+        outGlyph->AdvanceX = cached->AdvanceX;
+        outGlyph->X0 = cached->X0;
+        outGlyph->Y0 = cached->Y0;
+        outGlyph->X1 = cached->X1;
+        outGlyph->Y1 = cached->Y1;
+        outGlyph->Visible = (cached->Flags & FontCacheGlyph_Visible) ? 1 : 0;
+
+        if (outGlyph->Visible)
+        {
+            ImFontAtlasRectId packId = ImFontAtlasPackAddRect(atlas, cached->Width, cached->Height);
+            if (packId == ImFontAtlasRectId_Invalid)
+                return false;
 
-    float size = FONT_AWESOME_ICON_SIZE;
-#if !defined(__APPLE__)
-    if (!IsWindowState(FLAG_WINDOW_HIGHDPI))
-        size *= GetDisplayScale().y;
+            ImTextureRect* rect = ImFontAtlasPackGetRect(atlas, packId);
+            outGlyph->PackId = packId;
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, outGlyph, rect, pixels, ImTextureFormat_Alpha8, cached->Width);
+        }
+        return true;
+    }
 
-    icons_config.RasterizerMultiply = GetDisplayScale().y;
-#endif
+    cache->Stats.Misses++;
+    bool found = cache->Loader->FontBakedLoadGlyph(atlas, src, baked, loaderData, codepoint, outGlyph, outAdvanceX);
 
-    io.Fonts->AddFontFromMemoryCompressedTTF((void*)fa_solid_900_compressed_data, fa_solid_900_compressed_size, size, &icons_config, icons_ranges);
-#endif
+    // advance only queries are not stored, the full glyph is loaded when it is drawn. Color glyphs are not stored as alpha
+    if (!outGlyph || (found && outGlyph->Colored))
+        return found;
+
+    FontCacheGlyph glyph;
+    memset(&glyph, 0, sizeof(glyph));
+    glyph.SourceHash = sourceHash;
+    glyph.Size = baked->Size;
+    glyph.Density = baked->RasterizerDensity;
+    glyph.Codepoint = codepoint;
+
+    if (found)
+    {
+        glyph.Flags = FontCacheGlyph_Found;
+        glyph.AdvanceX = outGlyph->AdvanceX;
+        glyph.X0 = outGlyph->X0;
+        glyph.Y0 = outGlyph->Y0;
+        glyph.X1 = outGlyph->X1;
+        glyph.Y1 = outGlyph->Y1;
+
+        if (outGlyph->Visible)
+        {
+            // read the glyph back from the atlas, it is white with alpha when the atlas is RGBA
+            ImTextureData* tex = atlas->TexData;
+            ImTextureRect* rect = ImFontAtlasPackGetRect(atlas, outGlyph->PackId);
+            if (!tex || !rect)
+                return found;
+
+            glyph.Flags |= FontCacheGlyph_Visible;
+            glyph.Width = rect->w;
+            glyph.Height = rect->h;
+            glyph.PixelOffset = unsigned(cache->NewPixels.Size);
+            cache->NewPixels.resize(cache->NewPixels.Size + rect->w * rect->h);
+
+            unsigned char* dest = cache->NewPixels.Data + glyph.PixelOffset;
+            for (int y = 0; y < rect->h; y++)
+            {
+                const unsigned char* row = (const unsigned char*)tex->GetPixelsAt(rect->x, rect->y + y);
+                if (tex->Format == ImTextureFormat_Alpha8)
+                {
+                    memcpy(dest + y * rect->w, row, rect->w);
+                }
+                else
+                {
+                    for (int x = 0; x < rect->w; x++)
+                        dest[y * rect->w + x] = row[x * 4 + 3];
+                }
+            }
+        }
+    }
 
+    AddCachedGlyph(cache, glyph);
+    return found;
 }
 
-void SetupBackend(void)
+static bool InstallFontCacheLoader(ImFontAtlas* atlas)
 {
-    ImGuiIO& io = ImGui::GetIO();
-    io.BackendPlatformName = "imgui_impl_raylib";
-    io.BackendFlags |= ImGuiBackendFlags_HasGamepad | ImGuiBackendFlags_HasSetMousePos | ImGuiBackendFlags_RendererHasTextures;
-
-#ifndef PLATFORM_DRM
-    io.BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
+    const ImFontLoader* loader = atlas->FontLoader;
+#if defined(IMGUI_ENABLE_STB_TRUETYPE)
+    if (!loader)
+        loader = ImFontAtlasGetFontLoaderForStbTruetype();
 #endif
+    if (!loader || !loader->FontBakedLoadGlyph)
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: No font loader to cache, the font cache is disabled");
+        return false;
+    }
 
-    io.MousePos = ImVec2(0, 0);
+    ActiveFontCache->Loader = loader;
 
-    ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+    CachedFontLoader.Name = "rlImGui cache";
+    CachedFontLoader.LoaderInit = CachedLoaderInit;
+    CachedFontLoader.LoaderShutdown = CachedLoaderShutdown;
+    CachedFontLoader.FontSrcInit = CachedFontSrcInit;
+    CachedFontLoader.FontSrcDestroy = CachedFontSrcDestroy;
+    CachedFontLoader.FontSrcContainsGlyph = CachedFontSrcContainsGlyph;
+    CachedFontLoader.FontBakedInit = CachedFontBakedInit;
+    CachedFontLoader.FontBakedDestroy = CachedFontBakedDestroy;
+    CachedFontLoader.FontBakedLoadGlyph = CachedFontBakedLoadGlyph;
+    CachedFontLoader.FontBakedSrcLoaderDataSize = loader->FontBakedSrcLoaderDataSize;
 
-    platformIO.Platform_SetClipboardTextFn = SetClipTextCallback;
-    platformIO.Platform_GetClipboardTextFn = GetClipTextCallback;
+    atlas->SetFontLoader(&CachedFontLoader);
+    return true;
+}
 
-    platformIO.Platform_ClipboardUserData = nullptr;
+// every rlImGui context uses the same font atlas, so the fonts are only loaded once and there is one set of atlas textures.
+// the backend owns it, it holds a reference of its own so ImGui never deletes it, and deletes it when the last rlImGui context is gone
+static ImFontAtlas* SharedFontAtlas = nullptr;
+static int SharedFontAtlasContexts = 0;
+static bool SharedFontAtlasHasFonts = false;
 
-    ImGui_ImplRaylib_CreateBackendData();
-}
+// GPU textures made for ImGui, these are shared by all contexts
+static rlImGuiFontAtlasStats TextureStats = {};
 
-void rlImGuiEndInitImGui(void)
+// changed parts of a texture are copied here to be uploaded
+static ImVector<unsigned char> TextureUploadBuffer;
+
+// glyphs to bake at the start of the next frame, ImGui only bakes a glyph the first time it is drawn at a size
+struct PrewarmGlyph
 {
-    ImGui::SetCurrentContext(GlobalContext);
+    float Size;
+    ImWchar Codepoint;
+};
 
-    SetupFontAwesome();
+static ImVector<PrewarmGlyph> PendingPrewarmGlyphs;
 
-    SetupMouseCursors();
+static void PrewarmPendingGlyphs(void)
+{
+    if (PendingPrewarmGlyphs.empty())
+        return;
 
-    SetupBackend();
+    double start = GetTime();
+
+    // the font is pushed so the glyphs are baked at the same density the frame uses
+    float currentSize = -1;
+    ImFontBaked* baked = nullptr;
+    for (const PrewarmGlyph& glyph : PendingPrewarmGlyphs)
+    {
+        if (glyph.Size != currentSize)
+        {
+            if (baked)
+                ImGui::PopFont();
+            ImGui::PushFont(nullptr, glyph.Size);
+            baked = ImGui::GetFontBaked();
+            currentSize = glyph.Size;
+        }
+
+        if (!baked->IsGlyphLoaded(glyph.Codepoint))
+        {
+            baked->FindGlyph(glyph.Codepoint);
+            TextureStats.PrewarmedGlyphs++;
+        }
+    }
+    if (baked)
+        ImGui::PopFont();
+
+    PendingPrewarmGlyphs.clear();
+    TextureStats.PrewarmSeconds += GetTime() - start;
 }
 
-static void SetupKeymap(void)
-{
-    if (KeyMapInitialized)
-        return;
-
-    KeyMapInitialized = true;
-
-    memset(RaylibKeyMap, 0, MAX_RAYLIB_KEY * sizeof(ImGuiKey));
-
-    // build up a map of raylib keys to ImGuiKeys
-    RaylibKeyMap[KEY_APOSTROPHE] = ImGuiKey_Apostrophe;
-    RaylibKeyMap[KEY_COMMA] = ImGuiKey_Comma;
-    RaylibKeyMap[KEY_MINUS] = ImGuiKey_Minus;
-    RaylibKeyMap[KEY_PERIOD] = ImGuiKey_Period;
-    RaylibKeyMap[KEY_SLASH] = ImGuiKey_Slash;
-    RaylibKeyMap[KEY_ZERO] = ImGuiKey_0;
-    RaylibKeyMap[KEY_ONE] = ImGuiKey_1;
-    RaylibKeyMap[KEY_TWO] = ImGuiKey_2;
-    RaylibKeyMap[KEY_THREE] = ImGuiKey_3;
-    RaylibKeyMap[KEY_FOUR] = ImGuiKey_4;
-    RaylibKeyMap[KEY_FIVE] = ImGuiKey_5;
-    RaylibKeyMap[KEY_SIX] = ImGuiKey_6;
-    RaylibKeyMap[KEY_SEVEN] = ImGuiKey_7;
-    RaylibKeyMap[KEY_EIGHT] = ImGuiKey_8;
-    RaylibKeyMap[KEY_NINE] = ImGuiKey_9;
-    RaylibKeyMap[KEY_SEMICOLON] = ImGuiKey_Semicolon;
-    RaylibKeyMap[KEY_EQUAL] = ImGuiKey_Equal;
-    RaylibKeyMap[KEY_A] = ImGuiKey_A;
-    RaylibKeyMap[KEY_B] = ImGuiKey_B;
-    RaylibKeyMap[KEY_C] = ImGuiKey_C;
-    RaylibKeyMap[KEY_D] = ImGuiKey_D;
-    RaylibKeyMap[KEY_E] = ImGuiKey_E;
-    RaylibKeyMap[KEY_F] = ImGuiKey_F;
-    RaylibKeyMap[KEY_G] = ImGuiKey_G;
-    RaylibKeyMap[KEY_H] = ImGuiKey_H;
-    RaylibKeyMap[KEY_I] = ImGuiKey_I;
-    RaylibKeyMap[KEY_J] = ImGuiKey_J;
-    RaylibKeyMap[KEY_K] = ImGuiKey_K;
-    RaylibKeyMap[KEY_L] = ImGuiKey_L;
-    RaylibKeyMap[KEY_M] = ImGuiKey_M;
-    RaylibKeyMap[KEY_N] = ImGuiKey_N;
-    RaylibKeyMap[KEY_O] = ImGuiKey_O;
-    RaylibKeyMap[KEY_P] = ImGuiKey_P;
-    RaylibKeyMap[KEY_Q] = ImGuiKey_Q;
-    RaylibKeyMap[KEY_R] = ImGuiKey_R;
-    RaylibKeyMap[KEY_S] = ImGuiKey_S;
-    RaylibKeyMap[KEY_T] = ImGuiKey_T;
-    RaylibKeyMap[KEY_U] = ImGuiKey_U;
-    RaylibKeyMap[KEY_V] = ImGuiKey_V;
-    RaylibKeyMap[KEY_W] = ImGuiKey_W;
-    RaylibKeyMap[KEY_X] = ImGuiKey_X;
-    RaylibKeyMap[KEY_Y] = ImGuiKey_Y;
-    RaylibKeyMap[KEY_Z] = ImGuiKey_Z;
-    RaylibKeyMap[KEY_SPACE] = ImGuiKey_Space;
-    RaylibKeyMap[KEY_ESCAPE] = ImGuiKey_Escape;
-    RaylibKeyMap[KEY_ENTER] = ImGuiKey_Enter;
-    RaylibKeyMap[KEY_TAB] = ImGuiKey_Tab;
-    RaylibKeyMap[KEY_BACKSPACE] = ImGuiKey_Backspace;
-    RaylibKeyMap[KEY_INSERT] = ImGuiKey_Insert;
-    RaylibKeyMap[KEY_DELETE] = ImGuiKey_Delete;
-    RaylibKeyMap[KEY_RIGHT] = ImGuiKey_RightArrow;
-    RaylibKeyMap[KEY_LEFT] = ImGuiKey_LeftArrow;
-    RaylibKeyMap[KEY_DOWN] = ImGuiKey_DownArrow;
-    RaylibKeyMap[KEY_UP] = ImGuiKey_UpArrow;
-    RaylibKeyMap[KEY_PAGE_UP] = ImGuiKey_PageUp;
-    RaylibKeyMap[KEY_PAGE_DOWN] = ImGuiKey_PageDown;
-    RaylibKeyMap[KEY_HOME] = ImGuiKey_Home;
-    RaylibKeyMap[KEY_END] = ImGuiKey_End;
-    RaylibKeyMap[KEY_CAPS_LOCK] = ImGuiKey_CapsLock;
-    RaylibKeyMap[KEY_SCROLL_LOCK] = ImGuiKey_ScrollLock;
-    RaylibKeyMap[KEY_NUM_LOCK] = ImGuiKey_NumLock;
-    RaylibKeyMap[KEY_PRINT_SCREEN] = ImGuiKey_PrintScreen;
-    RaylibKeyMap[KEY_PAUSE] = ImGuiKey_Pause;
-    RaylibKeyMap[KEY_F1] = ImGuiKey_F1;
-    RaylibKeyMap[KEY_F2] = ImGuiKey_F2;
-    RaylibKeyMap[KEY_F3] = ImGuiKey_F3;
-    RaylibKeyMap[KEY_F4] = ImGuiKey_F4;
-    RaylibKeyMap[KEY_F5] = ImGuiKey_F5;
-    RaylibKeyMap[KEY_F6] = ImGuiKey_F6;
-    RaylibKeyMap[KEY_F7] = ImGuiKey_F7;
-    RaylibKeyMap[KEY_F8] = ImGuiKey_F8;
-    RaylibKeyMap[KEY_F9] = ImGuiKey_F9;
-    RaylibKeyMap[KEY_F10] = ImGuiKey_F10;
-    RaylibKeyMap[KEY_F11] = ImGuiKey_F11;
-    RaylibKeyMap[KEY_F12] = ImGuiKey_F12;
-    RaylibKeyMap[KEY_LEFT_SHIFT] = ImGuiKey_LeftShift;
-    RaylibKeyMap[KEY_LEFT_CONTROL] = ImGuiKey_LeftCtrl;
-    RaylibKeyMap[KEY_LEFT_ALT] = ImGuiKey_LeftAlt;
-    RaylibKeyMap[KEY_LEFT_SUPER] = ImGuiKey_LeftSuper;
-    RaylibKeyMap[KEY_RIGHT_SHIFT] = ImGuiKey_RightShift;
-    RaylibKeyMap[KEY_RIGHT_CONTROL] = ImGuiKey_RightCtrl;
-    RaylibKeyMap[KEY_RIGHT_ALT] = ImGuiKey_RightAlt;
-    RaylibKeyMap[KEY_RIGHT_SUPER] = ImGuiKey_RightSuper;
-    RaylibKeyMap[KEY_KB_MENU] = ImGuiKey_Menu;
-    RaylibKeyMap[KEY_LEFT_BRACKET] = ImGuiKey_LeftBracket;
-    RaylibKeyMap[KEY_BACKSLASH] = ImGuiKey_Backslash;
-    RaylibKeyMap[KEY_RIGHT_BRACKET] = ImGuiKey_RightBracket;
-    RaylibKeyMap[KEY_GRAVE] = ImGuiKey_GraveAccent;
-    RaylibKeyMap[KEY_KP_0] = ImGuiKey_Keypad0;
-    RaylibKeyMap[KEY_KP_1] = ImGuiKey_Keypad1;
-    RaylibKeyMap[KEY_KP_2] = ImGuiKey_Keypad2;
-    RaylibKeyMap[KEY_KP_3] = ImGuiKey_Keypad3;
-    RaylibKeyMap[KEY_KP_4] = ImGuiKey_Keypad4;
-    RaylibKeyMap[KEY_KP_5] = ImGuiKey_Keypad5;
-    RaylibKeyMap[KEY_KP_6] = ImGuiKey_Keypad6;
-    RaylibKeyMap[KEY_KP_7] = ImGuiKey_Keypad7;
-    RaylibKeyMap[KEY_KP_8] = ImGuiKey_Keypad8;
-    RaylibKeyMap[KEY_KP_9] = ImGuiKey_Keypad9;
-    RaylibKeyMap[KEY_KP_DECIMAL] = ImGuiKey_KeypadDecimal;
-    RaylibKeyMap[KEY_KP_DIVIDE] = ImGuiKey_KeypadDivide;
-    RaylibKeyMap[KEY_KP_MULTIPLY] = ImGuiKey_KeypadMultiply;
-    RaylibKeyMap[KEY_KP_SUBTRACT] = ImGuiKey_KeypadSubtract;
-    RaylibKeyMap[KEY_KP_ADD] = ImGuiKey_KeypadAdd;
-    RaylibKeyMap[KEY_KP_ENTER] = ImGuiKey_KeypadEnter;
-    RaylibKeyMap[KEY_KP_EQUAL] = ImGuiKey_KeypadEqual;
-}
-
-static void SetupGlobals(void)
-{
-    LastFrameFocused = IsWindowFocused();
-    LastControlPressed = false;
-    LastShiftPressed = false;
-    LastAltPressed = false;
-    LastSuperPressed = false;
+// font atlas budget.
+// ImGui keeps every size of every font it has drawn, so a long session keeps growing the atlas.
+// When the atlas texture is over the budget, the sizes that were used the longest time ago are discarded and the atlas is repacked.
+// If the sizes in use are still too big, every size is discarded and only the glyphs drawn after that are baked again.
+static long long FontAtlasBudget = 0;
+static int FontAtlasColdFrames = 300;
+static bool FontAtlasCompactRequested = false;
+static int FontAtlasLastRebakeFrame = -1;
+static bool FontAtlasBudgetWarned = false;
+static rlImGuiFontAtlasBudgetStats FontAtlasBudgetStats = {};
+
+static long long GetAtlasSizeBytes(const ImFontAtlas* atlas, ImVec2i size)
+{
+    return (long long)size.x * size.y * atlas->TexData->BytesPerPixel;
 }
 
-void rlImGuiBeginInitImGui(void)
+// discards a baked font size, every glyph rect in it is freed
+static void EvictBakedFont(ImFontAtlas* atlas, ImFontBaked* baked)
 {
-    SetupGlobals();
-    if (GlobalContext == nullptr)
-        GlobalContext = ImGui::CreateContext(nullptr);
-    SetupKeymap();
+    FontAtlasBudgetStats.EvictedGlyphs += (unsigned int)baked->Glyphs.Size;
+    FontAtlasBudgetStats.EvictedSizes++;
+    ImFontAtlasBakedDiscard(atlas, baked->ContainerFont, baked);
+}
 
-    ImGuiIO& io = ImGui::GetIO();
+// only called between frames, ImGui does not keep baked font pointers from one frame to the next
+static void UpdateFontAtlasBudget(void)
+{
+    ImFontAtlas* atlas = SharedFontAtlas;
+    if (!atlas || !SharedFontAtlasHasFonts || !atlas->Builder || !atlas->TexData || atlas->Locked)
+        return;
 
-    ImFontConfig defaultConfig;
+    bool forced = FontAtlasCompactRequested;
+    FontAtlasCompactRequested = false;
 
-    static constexpr int DefaultFonSize = 13;
+    long long textureBytes = atlas->TexData->GetSizeInBytes();
+    if (!forced && (FontAtlasBudget <= 0 || textureBytes <= FontAtlasBudget))
+        return;
 
-    defaultConfig.SizePixels = DefaultFonSize;
-#if !defined(__APPLE__)
-    if (!IsWindowState(FLAG_WINDOW_HIGHDPI))
-        defaultConfig.SizePixels = ceilf(defaultConfig.SizePixels * GetDisplayScale().y);
+    double start = GetTime();
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    long long budget = FontAtlasBudget > 0 ? FontAtlasBudget : textureBytes;
 
-    defaultConfig.RasterizerMultiply = GetDisplayScale().y;
-#endif
+    // sizes locked by the font can not be baked again, so they are never evicted
+    ImVector<ImFontBaked*> candidates;
+    for (int i = 0; i < builder->BakedPool.Size; i++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[i];
+        if (baked->WantDestroy || !baked->ContainerFont || (baked->ContainerFont->Flags & ImFontFlags_LockBakedSizes))
+            continue;
+        candidates.push_back(baked);
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const ImFontBaked* a, const ImFontBaked* b) { return a->LastUsedFrame < b->LastUsedFrame; });
 
-    defaultConfig.PixelSnapH = true;
-    io.Fonts->AddFontDefault(&defaultConfig);
+    // least recently used sizes first, until the repacked atlas would fit
+    int evicted = 0;
+    for (ImFontBaked* baked : candidates)
+    {
+        if (GetAtlasSizeBytes(atlas, ImFontAtlasTextureGetSizeEstimate(atlas)) <= budget)
+            break;
+        if (baked->LastUsedFrame + FontAtlasColdFrames > builder->FrameCount)
+            break;
+
+        EvictBakedFont(atlas, baked);
+        evicted++;
+    }
+
+    // the sizes in use hold glyphs that may not have been drawn in a long time, start them over.
+    // Not more often than the cold frames, so a budget that is too small does not rebake every frame
+    bool overBudget = GetAtlasSizeBytes(atlas, ImFontAtlasTextureGetSizeEstimate(atlas)) > budget;
+    if ((overBudget || forced) && (forced || FontAtlasLastRebakeFrame < 0 || builder->FrameCount - FontAtlasLastRebakeFrame >= FontAtlasColdFrames))
+    {
+        for (ImFontBaked* baked : candidates)
+        {
+            if (!baked->WantDestroy)
+            {
+                EvictBakedFont(atlas, baked);
+                evicted++;
+            }
+        }
+        FontAtlasLastRebakeFrame = builder->FrameCount;
+        FontAtlasBudgetStats.Rebakes++;
+    }
+    else if (overBudget && !FontAtlasBudgetWarned)
+    {
+        FontAtlasBudgetWarned = true;
+        TraceLog(LOG_WARNING, "RLIMGUI: The glyphs in use are bigger than the font atlas budget of %lld bytes", FontAtlasBudget);
+    }
+
+    // freed rects are only reused after a repack, the glyphs that are left are copied into the new texture
+    if (evicted > 0 || forced)
+    {
+        ImVec2i size = ImFontAtlasTextureGetSizeEstimate(atlas);
+        ImFontAtlasTextureRepack(atlas, size.x, size.y);
+        FontAtlasBudgetStats.Repacks++;
+    }
+
+    FontAtlasBudgetStats.EvictSeconds += GetTime() - start;
 }
 
-void rlImGuiSetup(bool dark)
+#if !defined(RLIMGUI_NO_SDF_FONTS)
+// signed distance field fonts.
+// A font loader bakes distance field glyphs with stb_truetype, and every font is locked to one baked size,
+// so ImGui scales that one set of glyphs for every font size and the backend draws them with a distance field shader.
+static constexpr int SdfGlyphPadding = 4;
+static constexpr unsigned char SdfOnEdgeValue = 128;
+static constexpr float SdfPixelDistScale = float(SdfOnEdgeValue) / SdfGlyphPadding;
+
+static bool SdfFontsEnabled = false;
+static float SdfReferenceSize = 32;
+static ImFontLoader SdfFontLoader;
+
+struct SdfFontSource
 {
-    rlImGuiBeginInitImGui();
+    stbtt_fontinfo FontInfo;
+    float ScaleFactor = 1;
+};
 
-    if (dark)
-        ImGui::StyleColorsDark();
+static bool SdfFontSrcInit(ImFontAtlas*, ImFontConfig* src)
+{
+    SdfFontSource* source = IM_NEW(SdfFontSource)();
+    int fontOffset = stbtt_GetFontOffsetForIndex((const unsigned char*)src->FontData, src->FontNo);
+    if (fontOffset < 0 || !stbtt_InitFont(&source->FontInfo, (const unsigned char*)src->FontData, fontOffset))
+    {
+        IM_DELETE(source);
+        TraceLog(LOG_WARNING, "RLIMGUI: Could not load a font for distance field glyphs");
+        return false;
+    }
+
+    // the same scale the stb_truetype loader uses, merged fonts are scaled against the first source
+    if (src->SizePixels >= 0.0f)
+        source->ScaleFactor = stbtt_ScaleForPixelHeight(&source->FontInfo, 1.0f);
     else
-        ImGui::StyleColorsLight();
+        source->ScaleFactor = stbtt_ScaleForMappingEmToPixels(&source->FontInfo, 1.0f);
 
-    rlImGuiEndInitImGui();
+    if (src->DstFont && !src->DstFont->Sources.empty() && src != src->DstFont->Sources[0] && src->DstFont->Sources[0]->SizePixels != 0.0f)
+        source->ScaleFactor *= src->SizePixels / src->DstFont->Sources[0]->SizePixels;
+
+    src->FontLoaderData = source;
+    return true;
 }
 
-void rlImGuiBegin(void)
+static void SdfFontSrcDestroy(ImFontAtlas*, ImFontConfig* src)
 {
-    ImGui::SetCurrentContext(GlobalContext);
-    rlImGuiBeginDelta(GetFrameTime());
+    SdfFontSource* source = (SdfFontSource*)src->FontLoaderData;
+    IM_DELETE(source);
+    src->FontLoaderData = nullptr;
 }
 
-void rlImGuiBeginDelta(float deltaTime)
+static bool SdfFontSrcContainsGlyph(ImFontAtlas*, ImFontConfig* src, ImWchar codepoint)
 {
-    ImGui::SetCurrentContext(GlobalContext);
+    SdfFontSource* source = (SdfFontSource*)src->FontLoaderData;
+    return stbtt_FindGlyphIndex(&source->FontInfo, int(codepoint)) != 0;
+}
 
-    ImGuiNewFrame(deltaTime);
-    ImGui_ImplRaylib_ProcessEvents();
-    ImGui::NewFrame();
+static bool SdfFontBakedInit(ImFontAtlas*, ImFontConfig* src, ImFontBaked* baked, void*)
+{
+    if (src->MergeMode)
+        return true;
+
+    SdfFontSource* source = (SdfFontSource*)src->FontLoaderData;
+    float scale = source->ScaleFactor * baked->Size;
+    int ascent = 0, descent = 0, lineGap = 0;
+    stbtt_GetFontVMetrics(&source->FontInfo, &ascent, &descent, &lineGap);
+    baked->Ascent = ceilf(ascent * scale);
+    baked->Descent = floorf(descent * scale);
+    return true;
 }
 
-void rlImGuiEnd(void)
+static bool SdfFontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* outGlyph, float* outAdvanceX)
 {
-    ImGui::SetCurrentContext(GlobalContext);
-    ImGui::Render();
-    ImGui_ImplRaylib_RenderDrawData(ImGui::GetDrawData());
+    SdfFontSource* source = (SdfFontSource*)src->FontLoaderData;
+    int glyphIndex = stbtt_FindGlyphIndex(&source->FontInfo, int(codepoint));
+    if (glyphIndex == 0)
+        return false;
+
+    float layoutScale = source->ScaleFactor * baked->Size;
+    float density = src->RasterizerDensity * baked->RasterizerDensity;
+
+    int advance = 0, leftSideBearing = 0;
+    stbtt_GetGlyphHMetrics(&source->FontInfo, glyphIndex, &advance, &leftSideBearing);
+    float advanceX = advance * layoutScale;
+    if (outAdvanceX)
+        *outAdvanceX = advanceX;
+    if (!outGlyph)
+        return true;
+
+    outGlyph->Codepoint = codepoint;
+    outGlyph->AdvanceX = advanceX;
+
+    int width = 0, height = 0, offsetX = 0, offsetY = 0;
+    unsigned char* pixels = stbtt_GetGlyphSDF(&source->FontInfo, layoutScale * density, glyphIndex, SdfGlyphPadding, SdfOnEdgeValue, SdfPixelDistScale, &width, &height, &offsetX, &offsetY);
+    if (!pixels)
+        return true;
+
+    ImFontAtlasRectId packId = ImFontAtlasPackAddRect(atlas, width, height);
+    if (packId == ImFontAtlasRectId_Invalid)
+    {
+        stbtt_FreeSDF(pixels, nullptr);
+        return false;
+    }
+
+    const float referenceSize = baked->ContainerFont->Sources[0]->SizePixels;
+    const float offsetScale = referenceSize != 0.0f ? baked->Size / referenceSize : 1.0f;
+    float fontOffsetX = src->GlyphOffset.x * offsetScale;
+    float fontOffsetY = src->GlyphOffset.y * offsetScale + floorf(baked->Ascent + 0.5f);
+
+    outGlyph->X0 = offsetX / density + fontOffsetX;
+    outGlyph->Y0 = offsetY / density + fontOffsetY;
+    outGlyph->X1 = (offsetX + width) / density + fontOffsetX;
+    outGlyph->Y1 = (offsetY + height) / density + fontOffsetY;
+    outGlyph->Visible = true;
+    outGlyph->PackId = packId;
+
+    ImTextureRect* rect = ImFontAtlasPackGetRect(atlas, packId);
+    ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, outGlyph, rect, pixels, ImTextureFormat_Alpha8, width);
+    stbtt_FreeSDF(pixels, nullptr);
+    return true;
 }
 
-void rlImGuiShutdown(void)
+static void InstallSdfFontLoader(ImFontAtlas* atlas)
 {
-    if (GlobalContext == nullptr)
-        return;
+    SdfFontLoader.Name = "rlImGui SDF";
+    SdfFontLoader.FontSrcInit = SdfFontSrcInit;
+    SdfFontLoader.FontSrcDestroy = SdfFontSrcDestroy;
+    SdfFontLoader.FontSrcContainsGlyph = SdfFontSrcContainsGlyph;
+    SdfFontLoader.FontBakedInit = SdfFontBakedInit;
+    SdfFontLoader.FontBakedLoadGlyph = SdfFontBakedLoadGlyph;
 
-    ImGui::SetCurrentContext(GlobalContext);
-    ImGui_ImplRaylib_Shutdown();
+    atlas->SetFontLoader(&SdfFontLoader);
 
-    ImGui::DestroyContext(GlobalContext);
-    GlobalContext = nullptr;
+    // the shader thresholds everything drawn from the atlas, so lines are drawn as geometry instead of baked lines
+    atlas->Flags |= ImFontAtlasFlags_NoBakedLines;
 }
 
-void rlImGuiImage(const Texture* image)
+// locks every font to the reference size, so no other size is baked
+static void LockSdfFontSizes(ImFontAtlas* atlas)
 {
-    if (!image)
+    if (!SdfFontsEnabled)
         return;
-    
-    if (GlobalContext)
-        ImGui::SetCurrentContext(GlobalContext);
-    
-    ImGui::Image(ImTextureID(image->id), ImVec2(float(image->width), float(image->height)));
+
+    for (ImFont* font : atlas->Fonts)
+    {
+        font->GetFontBaked(SdfReferenceSize, 1.0f);
+        font->Flags |= ImFontFlags_LockBakedSizes;
+    }
 }
 
-bool rlImGuiImageButton(const char* name, const Texture* image)
+// the distance field is turned into coverage with the screen space rate of change, so edges stay sharp at any scale
+static const char* SdfFragmentShader330 = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+out vec4 finalColor;
+void main()
 {
-    if (!image)
-        return false;
-    
-    if (GlobalContext)
-        ImGui::SetCurrentContext(GlobalContext);
-    
-    return ImGui::ImageButton(name, ImTextureID(image->id), ImVec2(float(image->width), float(image->height)));
+    vec4 texel = texture(texture0, fragTexCoord);
+    float width = max(fwidth(texel.a), 0.0001);
+    float coverage = clamp((texel.a - 0.5) / width + 0.5, 0.0, 1.0);
+    finalColor = vec4(texel.rgb, coverage) * fragColor * colDiffuse;
 }
-
-bool rlImGuiImageButtonSize(const char* name, const Texture* image, Vector2 size)
+)";
+
+static const char* SdfFragmentShader120 = R"(#version 120
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+void main()
 {
-    if (!image)
-        return false;
-    
-    if (GlobalContext)
-        ImGui::SetCurrentContext(GlobalContext);
-   
-    return ImGui::ImageButton(name, ImTextureID(image->id), ImVec2(size.x, size.y));
+    vec4 texel = texture2D(texture0, fragTexCoord);
+    float width = max(fwidth(texel.a), 0.0001);
+    float coverage = clamp((texel.a - 0.5) / width + 0.5, 0.0, 1.0);
+    gl_FragColor = vec4(texel.rgb, coverage) * fragColor * colDiffuse;
 }
-
-void rlImGuiImageSize(const Texture* image, int width, int height)
+)";
+
+static const char* SdfFragmentShader100 = R"(#version 100
+#extension GL_OES_standard_derivatives : enable
+precision mediump float;
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+void main()
 {
-    if (!image)
-        return;
-    
-    if (GlobalContext)
-        ImGui::SetCurrentContext(GlobalContext);
-    
-    ImGui::Image(ImTextureID(image->id), ImVec2(float(width), float(height)));
+    vec4 texel = texture2D(texture0, fragTexCoord);
+    float width = max(fwidth(texel.a), 0.0001);
+    float coverage = clamp((texel.a - 0.5) / width + 0.5, 0.0, 1.0);
+    gl_FragColor = vec4(texel.rgb, coverage) * fragColor * colDiffuse;
 }
-
-void rlImGuiImageSizeV(const Texture* image, Vector2 size)
+)";
+
+static const char* SdfFragmentShader300es = R"(#version 300 es
+precision mediump float;
+in vec2 fragTexCoord;
+in vec4 fragColor;
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+out vec4 finalColor;
+void main()
 {
-    if (!image)
-        return;
-    
-    if (GlobalContext)
-        ImGui::SetCurrentContext(GlobalContext);
-    
-    ImGui::Image(ImTextureID(image->id), ImVec2(size.x, size.y));
+    vec4 texel = texture(texture0, fragTexCoord);
+    float width = max(fwidth(texel.a), 0.0001);
+    float coverage = clamp((texel.a - 0.5) / width + 0.5, 0.0, 1.0);
+    finalColor = vec4(texel.rgb, coverage) * fragColor * colDiffuse;
 }
+)";
 
-void rlImGuiImageRect(const Texture* image, int destWidth, int destHeight, Rectangle sourceRect)
+static Shader SdfFontShader = { 0 };
+static bool SdfFontShaderLoaded = false;
+
+// loaded the first time it is needed, on the thread that draws
+static bool GetSdfFontShader(Shader& shader)
 {
-    if (!image)
-        return;
-    
-    if (GlobalContext)
-        ImGui::SetCurrentContext(GlobalContext);
-    
-    ImVec2 uv0;
-    ImVec2 uv1;
+    if (!SdfFontsEnabled)
+        return false;
 
-    if (sourceRect.width < 0)
-    {
-        uv0.x = -sourceRect.x / image->width;
-        uv1.x = (uv0.x - float(fabs(sourceRect.width) / image->width));
-    }
-    else
+    if (!SdfFontShaderLoaded)
     {
-        uv0.x = sourceRect.x / image->width;
-        uv1.x = uv0.x + float(sourceRect.width / image->width);
-    }
+        SdfFontShaderLoaded = true;
 
-    if (sourceRect.height < 0)
-    {
-        uv0.y = -sourceRect.y / image->height;
-        uv1.y = (uv0.y - fabsf(sourceRect.height) / image->height);
-    }
-    else
-    {
-        uv0.y = sourceRect.y / image->height;
-        uv1.y = uv0.y + sourceRect.height / image->height;
+        const char* fragment = nullptr;
+        switch (rlGetVersion())
+        {
+        case RL_OPENGL_21: fragment = SdfFragmentShader120; break;
+        case RL_OPENGL_33:
+        case RL_OPENGL_43: fragment = SdfFragmentShader330; break;
+        case RL_OPENGL_ES_20: fragment = SdfFragmentShader100; break;
+        case RL_OPENGL_ES_30: fragment = SdfFragmentShader300es; break;
+        default: break;
+        }
+
+        if (fragment)
+            SdfFontShader = LoadShaderFromMemory(nullptr, fragment);
+
+        if (!fragment || SdfFontShader.id == rlGetShaderIdDefault())
+            TraceLog(LOG_WARNING, "RLIMGUI: Distance field font shader is not supported, text will not be smooth");
     }
 
-    ImGui::Image((ImTextureID)image->id, ImVec2(float(destWidth), float(destHeight)), uv0, uv1);
+    if (SdfFontShader.id == 0 || SdfFontShader.id == rlGetShaderIdDefault())
+        return false;
+
+    shader = SdfFontShader;
+    return true;
 }
 
-void rlImGuiImageRenderTexture(const RenderTexture* image)
+static void UnloadSdfFontShader(void)
 {
-    if (!image)
-        return;
-    
-    if (GlobalContext)
-        ImGui::SetCurrentContext(GlobalContext);
-    
-    rlImGuiImageRect(&image->texture, image->texture.width, image->texture.height, Rectangle{ 0,0, float(image->texture.width), -float(image->texture.height) });
+    if (SdfFontShaderLoaded && SdfFontShader.id != 0 && SdfFontShader.id != rlGetShaderIdDefault())
+        UnloadShader(SdfFontShader);
+
+    SdfFontShader = Shader{ 0 };
+    SdfFontShaderLoaded = false;
 }
+#else
+static constexpr bool SdfFontsEnabled = false;
+static void InstallSdfFontLoader(ImFontAtlas*) {}
+static void LockSdfFontSizes(ImFontAtlas*) {}
+static bool GetSdfFontShader(Shader&) { return false; }
+static void UnloadSdfFontShader(void) {}
+#endif // RLIMGUI_NO_SDF_FONTS
+
+// the glyphs a session used, saved at shutdown and baked during setup on the next launch
+static constexpr char GlyphRecordMagic[4] = { 'R', 'I', 'G', 'R' };
+static constexpr unsigned int GlyphRecordVersion = 1;
+
+struct GlyphRecordHeader
+{
+    char Magic[4];
+    unsigned int Version;
+    unsigned int EntryCount;
+};
 
-void rlImGuiImageRenderTextureFit(const RenderTexture* image, bool center)
+struct GlyphRecordEntry
 {
-    if (!image)
-        return;
-    
-    if (GlobalContext)
-        ImGui::SetCurrentContext(GlobalContext);
+    int FontIndex;
+    float Size;
+    float Density;
+    unsigned int Codepoint;
+};
 
-    ImVec2 area = ImGui::GetContentRegionAvail();
+static char* GlyphRecordFileName = nullptr;
 
-    float scale =  area.x / image->texture.width;
+static void PrewarmRecordedGlyphs(ImFontAtlas* atlas)
+{
+    int dataSize = 0;
+    unsigned char* data = FileExists(GlyphRecordFileName) ? LoadFileData(GlyphRecordFileName, &dataSize) : nullptr;
+    if (!data)
+        return;
 
-    float y = image->texture.height * scale;
-    if (y > area.y)
+    GlyphRecordHeader header = { 0 };
+    if (dataSize >= int(sizeof(GlyphRecordHeader)))
+        memcpy(&header, data, sizeof(GlyphRecordHeader));
+
+    if (memcmp(header.Magic, GlyphRecordMagic, sizeof(header.Magic)) != 0 || header.Version != GlyphRecordVersion
+        || size_t(dataSize) < sizeof(GlyphRecordHeader) + size_t(header.EntryCount) * sizeof(GlyphRecordEntry))
     {
-        scale = area.y / image->texture.height;
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Invalid glyph record file", GlyphRecordFileName);
+        UnloadFileData(data);
+        return;
     }
 
-    int sizeX = int(image->texture.width * scale);
-    int sizeY = int(image->texture.height * scale);
+    double start = GetTime();
 
-    if (center)
+    // entries are saved grouped by baked font, so the baked font is only looked up when it changes
+    const GlyphRecordEntry* entries = (const GlyphRecordEntry*)(data + sizeof(GlyphRecordHeader));
+    ImFontBaked* baked = nullptr;
+    for (unsigned int i = 0; i < header.EntryCount; i++)
     {
-        ImGui::SetCursorPosX(0);
-        ImGui::SetCursorPosX(area.x/2 - sizeX/2);
-        ImGui::SetCursorPosY(ImGui::GetCursorPosY() + (area.y / 2 - sizeY / 2));
+        const GlyphRecordEntry& entry = entries[i];
+        if (entry.FontIndex < 0 || entry.FontIndex >= atlas->Fonts.Size || entry.Codepoint > IM_UNICODE_CODEPOINT_MAX)
+            continue;
+
+        if (!baked || baked->ContainerFont != atlas->Fonts[entry.FontIndex] || baked->Size != entry.Size || baked->RasterizerDensity != entry.Density)
+            baked = atlas->Fonts[entry.FontIndex]->GetFontBaked(entry.Size, entry.Density);
+
+        if (baked && !baked->IsGlyphLoaded(ImWchar(entry.Codepoint)))
+        {
+            baked->FindGlyph(ImWchar(entry.Codepoint));
+            TextureStats.PrewarmedGlyphs++;
+        }
     }
 
-    rlImGuiImageRect(&image->texture, sizeX, sizeY, Rectangle{ 0,0, float(image->texture.width), -float(image->texture.height) });
+    TextureStats.PrewarmSeconds += GetTime() - start;
+    UnloadFileData(data);
 }
 
-// raw ImGui backend API
-bool ImGui_ImplRaylib_Init(void)
-{
-    SetupGlobals();
+// fonts being added to a new atlas on a worker thread by rlImGuiSetupAsync
+struct AsyncFontSetup;
+static AsyncFontSetup* PendingFontSetup = nullptr;
+static bool FinishAsyncSetup(bool wait);
 
-    SetupKeymap();
+static ImFontAtlas* CreateFontAtlas(void)
+{
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+    if (SdfFontsEnabled)
+        InstallSdfFontLoader(atlas);
+    if (ActiveFontCache && !InstallFontCacheLoader(atlas))
+        DestroyFontCache();
+    return atlas;
+}
 
-    SetupMouseCursors();
+static void SetSharedFontAtlas(ImFontAtlas* atlas, bool hasFonts)
+{
+    IM_ASSERT(SharedFontAtlas == nullptr && SharedFontAtlasContexts == 0);
+    SharedFontAtlas = atlas;
+    SharedFontAtlas->RefCount++;
+    SharedFontAtlasHasFonts = hasFonts;
+}
 
-    SetupBackend();
+static ImFontAtlas* AcquireSharedFontAtlas(void)
+{
+    if (SharedFontAtlas == nullptr)
+        SetSharedFontAtlas(CreateFontAtlas(), false);
 
-    return true;
+    SharedFontAtlasContexts++;
+    return SharedFontAtlas;
 }
 
-
-void ImGui_ImplRaylib_Shutdown()
+// call after the context was destroyed, so it no longer references the atlas
+static void ReleaseSharedFontAtlas(void)
 {
-    ImGuiIO& io =ImGui::GetIO();
-
-    for (auto& texture : ImGui::GetPlatformIO().Textures)
-    {
-        if (texture->Status != ImTextureStatus_Destroyed)
-        {
-            Texture* backendData = (Texture*)texture->BackendUserData;
-            if (backendData && IsTextureValid(*backendData))
-            {
-                UnloadTexture(*backendData);
-            }
-            if (backendData)
-                MemFree(backendData);
+    if (SharedFontAtlasContexts <= 0 || --SharedFontAtlasContexts > 0)
+        return;
 
-            texture->BackendUserData = nullptr;
-            texture->Status = ImTextureStatus_Destroyed;
-            texture->SetTexID(ImTextureID_Invalid);
-        }
-    }
+    ImFontAtlas* atlas = SharedFontAtlas;
+    SharedFontAtlas = nullptr;
+    SharedFontAtlasHasFonts = false;
 
-    ImGui_ImplRaylib_FreeBackendData();
+    atlas->RefCount--;
+    IM_ASSERT(atlas->RefCount == 0 && "a context that is not rlImGui's still uses the shared font atlas");
+    atlas->Locked = false;
+    IM_DELETE(atlas);
 }
 
-void ImGui_ImplRaylib_NewFrame(void)
+static constexpr int MAX_RAYLIB_KEY = KEY_KB_MENU + 1;
+
+// map of raylib keys to ImGuiKeys, every key can only be listed once so the map can be walked in both directions
+struct RaylibKeyPair
 {
-    ImGuiNewFrame(GetFrameTime());
-}
+    int RaylibKey;
+    ImGuiKey ImKey;
+};
 
-void ImGui_ImplRaylib_UpdateTexture(ImTextureData* tex)
+static constexpr RaylibKeyPair RaylibKeyPairs[] =
 {
-    switch (tex->Status)
-    {
+    { KEY_APOSTROPHE, ImGuiKey_Apostrophe },
+    { KEY_COMMA, ImGuiKey_Comma },
+    { KEY_MINUS, ImGuiKey_Minus },
+    { KEY_PERIOD, ImGuiKey_Period },
+    { KEY_SLASH, ImGuiKey_Slash },
+    { KEY_ZERO, ImGuiKey_0 },
+    { KEY_ONE, ImGuiKey_1 },
+    { KEY_TWO, ImGuiKey_2 },
+    { KEY_THREE, ImGuiKey_3 },
+    { KEY_FOUR, ImGuiKey_4 },
+    { KEY_FIVE, ImGuiKey_5 },
+    { KEY_SIX, ImGuiKey_6 },
+    { KEY_SEVEN, ImGuiKey_7 },
+    { KEY_EIGHT, ImGuiKey_8 },
+    { KEY_NINE, ImGuiKey_9 },
+    { KEY_SEMICOLON, ImGuiKey_Semicolon },
+    { KEY_EQUAL, ImGuiKey_Equal },
+    { KEY_A, ImGuiKey_A },
+    { KEY_B, ImGuiKey_B },
+    { KEY_C, ImGuiKey_C },
+    { KEY_D, ImGuiKey_D },
+    { KEY_E, ImGuiKey_E },
+    { KEY_F, ImGuiKey_F },
+    { KEY_G, ImGuiKey_G },
+    { KEY_H, ImGuiKey_H },
+    { KEY_I, ImGuiKey_I },
+    { KEY_J, ImGuiKey_J },
+    { KEY_K, ImGuiKey_K },
+    { KEY_L, ImGuiKey_L },
+    { KEY_M, ImGuiKey_M },
+    { KEY_N, ImGuiKey_N },
+    { KEY_O, ImGuiKey_O },
+    { KEY_P, ImGuiKey_P },
+    { KEY_Q, ImGuiKey_Q },
+    { KEY_R, ImGuiKey_R },
+    { KEY_S, ImGuiKey_S },
+    { KEY_T, ImGuiKey_T },
+    { KEY_U, ImGuiKey_U },
+    { KEY_V, ImGuiKey_V },
+    { KEY_W, ImGuiKey_W },
+    { KEY_X, ImGuiKey_X },
+    { KEY_Y, ImGuiKey_Y },
+    { KEY_Z, ImGuiKey_Z },
+    { KEY_SPACE, ImGuiKey_Space },
+    { KEY_ESCAPE, ImGuiKey_Escape },
+    { KEY_ENTER, ImGuiKey_Enter },
+    { KEY_TAB, ImGuiKey_Tab },
+    { KEY_BACKSPACE, ImGuiKey_Backspace },
+    { KEY_INSERT, ImGuiKey_Insert },
+    { KEY_DELETE, ImGuiKey_Delete },
+    { KEY_RIGHT, ImGuiKey_RightArrow },
+    { KEY_LEFT, ImGuiKey_LeftArrow },
+    { KEY_DOWN, ImGuiKey_DownArrow },
+    { KEY_UP, ImGuiKey_UpArrow },
+    { KEY_PAGE_UP, ImGuiKey_PageUp },
+    { KEY_PAGE_DOWN, ImGuiKey_PageDown },
+    { KEY_HOME, ImGuiKey_Home },
+    { KEY_END, ImGuiKey_End },
+    { KEY_CAPS_LOCK, ImGuiKey_CapsLock },
+    { KEY_SCROLL_LOCK, ImGuiKey_ScrollLock },
+    { KEY_NUM_LOCK, ImGuiKey_NumLock },
+    { KEY_PRINT_SCREEN, ImGuiKey_PrintScreen },
+    { KEY_PAUSE, ImGuiKey_Pause },
+    { KEY_F1, ImGuiKey_F1 },
+    { KEY_F2, ImGuiKey_F2 },
+    { KEY_F3, ImGuiKey_F3 },
+    { KEY_F4, ImGuiKey_F4 },
+    { KEY_F5, ImGuiKey_F5 },
+    { KEY_F6, ImGuiKey_F6 },
+    { KEY_F7, ImGuiKey_F7 },
+    { KEY_F8, ImGuiKey_F8 },
+    { KEY_F9, ImGuiKey_F9 },
+    { KEY_F10, ImGuiKey_F10 },
+    { KEY_F11, ImGuiKey_F11 },
+    { KEY_F12, ImGuiKey_F12 },
+
+    // raylib has no names for F13-F24, but passes the GLFW key codes through unchanged
+    { KEY_F12 + 1, ImGuiKey_F13 },
+    { KEY_F12 + 2, ImGuiKey_F14 },
+    { KEY_F12 + 3, ImGuiKey_F15 },
+    { KEY_F12 + 4, ImGuiKey_F16 },
+    { KEY_F12 + 5, ImGuiKey_F17 },
+    { KEY_F12 + 6, ImGuiKey_F18 },
+    { KEY_F12 + 7, ImGuiKey_F19 },
+    { KEY_F12 + 8, ImGuiKey_F20 },
+    { KEY_F12 + 9, ImGuiKey_F21 },
+    { KEY_F12 + 10, ImGuiKey_F22 },
+    { KEY_F12 + 11, ImGuiKey_F23 },
+    { KEY_F12 + 12, ImGuiKey_F24 },
+
+    { KEY_LEFT_SHIFT, ImGuiKey_LeftShift },
+    { KEY_LEFT_CONTROL, ImGuiKey_LeftCtrl },
+    { KEY_LEFT_ALT, ImGuiKey_LeftAlt },
+    { KEY_LEFT_SUPER, ImGuiKey_LeftSuper },
+    { KEY_RIGHT_SHIFT, ImGuiKey_RightShift },
+    { KEY_RIGHT_CONTROL, ImGuiKey_RightCtrl },
+    { KEY_RIGHT_ALT, ImGuiKey_RightAlt },
+    { KEY_RIGHT_SUPER, ImGuiKey_RightSuper },
+    { KEY_KB_MENU, ImGuiKey_Menu },
+    { KEY_LEFT_BRACKET, ImGuiKey_LeftBracket },
+    { KEY_BACKSLASH, ImGuiKey_Backslash },
+    { KEY_RIGHT_BRACKET, ImGuiKey_RightBracket },
+    { KEY_GRAVE, ImGuiKey_GraveAccent },
+    { KEY_KP_0, ImGuiKey_Keypad0 },
+    { KEY_KP_1, ImGuiKey_Keypad1 },
+    { KEY_KP_2, ImGuiKey_Keypad2 },
+    { KEY_KP_3, ImGuiKey_Keypad3 },
+    { KEY_KP_4, ImGuiKey_Keypad4 },
+    { KEY_KP_5, ImGuiKey_Keypad5 },
+    { KEY_KP_6, ImGuiKey_Keypad6 },
+    { KEY_KP_7, ImGuiKey_Keypad7 },
+    { KEY_KP_8, ImGuiKey_Keypad8 },
+    { KEY_KP_9, ImGuiKey_Keypad9 },
+    { KEY_KP_DECIMAL, ImGuiKey_KeypadDecimal },
+    { KEY_KP_DIVIDE, ImGuiKey_KeypadDivide },
+    { KEY_KP_MULTIPLY, ImGuiKey_KeypadMultiply },
+    { KEY_KP_SUBTRACT, ImGuiKey_KeypadSubtract },
+    { KEY_KP_ADD, ImGuiKey_KeypadAdd },
+    { KEY_KP_ENTER, ImGuiKey_KeypadEnter },
+    { KEY_KP_EQUAL, ImGuiKey_KeypadEqual },
+
+    // non US keyboards (GLFW_KEY_WORLD_1) and the android back button
+    { 161, ImGuiKey_Oem102 },
+    { KEY_BACK, ImGuiKey_AppBack },
+
+    // KEY_MENU (android), KEY_VOLUME_UP and KEY_VOLUME_DOWN have no ImGui equivalent, and F25 is past the last ImGui function key
+};
+
+static constexpr int RaylibKeyPairCount = int(sizeof(RaylibKeyPairs) / sizeof(RaylibKeyPairs[0]));
+
+struct RaylibKeyTable
+{
+    ImGuiKey ToImGui[MAX_RAYLIB_KEY] = {};
+    int ToRaylib[ImGuiKey_NamedKey_COUNT] = {};
+};
+
+static constexpr bool RaylibKeyPairsAreValid(void)
+{
+    for (int i = 0; i < RaylibKeyPairCount; i++)
+    {
+        const RaylibKeyPair& pair = RaylibKeyPairs[i];
+        if (pair.RaylibKey <= KEY_NULL || pair.RaylibKey >= MAX_RAYLIB_KEY)
+            return false;
+
+        if (pair.ImKey < ImGuiKey_NamedKey_BEGIN || pair.ImKey >= ImGuiKey_NamedKey_END)
+            return false;
+
+        for (int j = i + 1; j < RaylibKeyPairCount; j++)
+        {
+            if (pair.RaylibKey == RaylibKeyPairs[j].RaylibKey || pair.ImKey == RaylibKeyPairs[j].ImKey)
+                return false;
+        }
+    }
+    return true;
+}
+
+static_assert(RaylibKeyPairsAreValid(), "raylib key map entries must be in range and unique in both directions");
+
+static constexpr RaylibKeyTable BuildKeyTable(void)
+{
+    RaylibKeyTable table;
+    for (const RaylibKeyPair& pair : RaylibKeyPairs)
+    {
+        table.ToImGui[pair.RaylibKey] = pair.ImKey;
+        table.ToRaylib[pair.ImKey - ImGuiKey_NamedKey_BEGIN] = pair.RaylibKey;
+    }
+    return table;
+}
+
+static constexpr RaylibKeyTable KeyTable = BuildKeyTable();
+
+// internal only functions
+bool rlImGuiIsControlDown() { return IsKeyDown(KEY_RIGHT_CONTROL) || IsKeyDown(KEY_LEFT_CONTROL); }
+bool rlImGuiIsShiftDown() { return IsKeyDown(KEY_RIGHT_SHIFT) || IsKeyDown(KEY_LEFT_SHIFT); }
+bool rlImGuiIsAltDown() { return IsKeyDown(KEY_RIGHT_ALT) || IsKeyDown(KEY_LEFT_ALT); }
+bool rlImGuiIsSuperDown() { return IsKeyDown(KEY_RIGHT_SUPER) || IsKeyDown(KEY_LEFT_SUPER); }
+
+// input events are recorded as raylib automation events, with our own event types and the params holding the ImGui event data
+enum InputEventType : unsigned int
+{
+    InputEvent_DeltaTime = 0,   // params: delta time
+    InputEvent_DisplaySize,     // params: width, height, framebuffer scale x, framebuffer scale y
+    InputEvent_Focus,           // params: focused
+    InputEvent_Key,             // params: ImGuiKey, down
+    InputEvent_KeyAnalog,       // params: ImGuiKey, down, value
+    InputEvent_Char,            // params: codepoint
+    InputEvent_MousePos,        // params: x, y
+    InputEvent_MouseButton,     // params: button, down
+    InputEvent_MouseWheel,      // params: x, y
+};
+
+static int FloatToParam(float value)
+{
+    int param = 0;
+    memcpy(&param, &value, sizeof(param));
+    return param;
+}
+
+static float ParamToFloat(int param)
+{
+    float value = 0;
+    memcpy(&value, &param, sizeof(value));
+    return value;
+}
+
+// an input event that has been sent to ImGui but not drawn yet
+struct InputLatencySample
+{
+    double Capture;
+    double Submit;
+};
+
+static constexpr unsigned int InputLatencyHistorySize = 1024;
+
+struct ImGui_ImplRaylib_Data
+{
+    bool LastFrameFocused = false;
+    bool LastControlPressed = false;
+    bool LastShiftPressed = false;
+    bool LastAltPressed = false;
+    bool LastSuperPressed = false;
+    ImGuiMouseCursor CurrentMouseCursor = ImGuiMouseCursor_COUNT;
+
+    // the next polled input this context has not been sent, so a context that skips frames catches up when it polls again
+    unsigned int NextPolledInput = 0;
+
+    // where the context draws and which input it gets
+    bool HasTarget = false;
+    RenderTexture Target = { 0 };
+    bool InputEnabled = true;
+    bool HasInputRect = false;
+    Rectangle InputRect = { 0, 0, 0, 0 };
+    bool ExternalInput = false;
+
+    bool Recording = false;
+    AutomationEventList Recorded = { 0 };
+    unsigned int RecordFrame = 0;
+    ImVec2 LastRecordedDisplaySize = ImVec2(-1, -1);
+    ImVec2 LastRecordedFramebufferScale = ImVec2(-1, -1);
+    ImVec2 LastRecordedMousePos = ImVec2(-1, -1);
+    float LastAnalogValue[ImGuiKey_NamedKey_COUNT] = {};
+
+    bool Replaying = false;
+    AutomationEventList Replay = { 0 };
+    unsigned int ReplayFrame = 0;
+    unsigned int ReplayFrameCount = 0;
+    unsigned int ReplayCursor = 0;
+    ImVec2 ReplayDisplaySize = ImVec2(-1, -1);
+    ImVec2 ReplayFramebufferScale = ImVec2(1, 1);
+
+    bool LatencyTracking = false;
+    double LatencyCaptureTime = 0;
+    double LatencyLastDrawTime = 0;
+    ImVec2 LatencyLastMousePos = ImVec2(-1, -1);
+    ImVector<InputLatencySample> LatencyPending;
+    rlImGuiInputLatencyStats LatencyFrame = {};
+    float LatencyHistory[InputLatencyHistorySize] = {};
+    unsigned int LatencyHistoryCount = 0;
+    unsigned int LatencyHistoryHead = 0;
+
+    bool LatchedMouseValid = false;
+    ImVec2 LatchedMousePos = ImVec2(0, 0);
+    double LatchedMouseTime = 0;
+    bool LateSoftwareCursor = false;
+};
+
+// raylib only keeps the key and button changes and the text of the last frame, and its text queue is emptied by the first context
+// that reads it, so every context that polls raylib adds what changed to one log that each context reads from where it left off
+enum PolledInputType
+{
+    PolledInput_Key,            // value: index in RaylibKeyPairs
+    PolledInput_MouseButton,    // value: ImGuiMouseButton, with the mouse position
+    PolledInput_Char,           // value: the char
+};
+
+struct PolledInput
+{
+    int Type;
+    int Value;
+    bool Down;
+    float X, Y;
+};
+
+static constexpr int PolledInputLimit = 512;
+static ImVector<PolledInput> PolledInputs;
+static unsigned int PolledInputStart = 0;       // how many inputs were dropped from the front
+static bool PolledKeysDown[RaylibKeyPairCount] = {};
+static unsigned int PolledMouseButtonsDown = 0;
+
+ImGui_ImplRaylib_Data* ImGui_ImplRaylib_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? static_cast<ImGui_ImplRaylib_Data*>(ImGui::GetPlatformIO().Renderer_RenderState) : nullptr;
+}
+
+void ImGui_ImplRaylib_CreateBackendData()
+{
+    if (!ImGui::GetCurrentContext() || ImGui::GetPlatformIO().Renderer_RenderState)
+        return;
+
+    ImGui_ImplRaylib_Data* platData = IM_NEW(ImGui_ImplRaylib_Data)();
+    platData->LastFrameFocused = IsWindowFocused();
+    platData->NextPolledInput = PolledInputStart + PolledInputs.Size;
+    ImGui::GetPlatformIO().Renderer_RenderState = platData;
+}
+
+void ImGui_ImplRaylib_FreeBackendData()
+{
+    if (!ImGui::GetCurrentContext())
+        return;
+
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (platData)
+    {
+        MemFree(platData->Recorded.events);
+        MemFree(platData->Replay.events);
+        IM_DELETE(platData);
+    }
+    ImGui::GetPlatformIO().Renderer_RenderState = nullptr;
+}
+
+
+// input latency is measured from the time an event was captured to the time the frame using it has been drawn
+static void TrackInputLatency(ImGui_ImplRaylib_Data* platData)
+{
+    if (!platData || !platData->LatencyTracking || platData->LatencyPending.Size >= int(InputLatencyHistorySize))
+        return;
+
+    InputLatencySample sample;
+    sample.Capture = platData->LatencyCaptureTime;
+    sample.Submit = GetTime();
+    platData->LatencyPending.push_back(sample);
+}
+
+static void FinishInputLatencyFrame(double renderTime)
+{
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (!platData)
+        return;
+
+    double drawTime = GetTime();
+    platData->LatencyLastDrawTime = drawTime;
+
+    // keep the stats from the last frame that had any input
+    if (!platData->LatencyTracking || platData->LatencyPending.Size == 0)
+        return;
+
+    rlImGuiInputLatencyStats& frame = platData->LatencyFrame;
+    frame.FrameEventCount = (unsigned int)platData->LatencyPending.Size;
+    frame.FrameCaptureToSubmitMs = 0;
+    frame.FrameSubmitToRenderMs = 0;
+    frame.FrameRenderToDrawMs = float((drawTime - renderTime) * 1000.0);
+    frame.FrameTotalMs = 0;
+
+    for (const InputLatencySample& sample : platData->LatencyPending)
+    {
+        float total = float((drawTime - sample.Capture) * 1000.0);
+        frame.FrameCaptureToSubmitMs = std::max(frame.FrameCaptureToSubmitMs, float((sample.Submit - sample.Capture) * 1000.0));
+        frame.FrameSubmitToRenderMs = std::max(frame.FrameSubmitToRenderMs, float((renderTime - sample.Submit) * 1000.0));
+        frame.FrameTotalMs = std::max(frame.FrameTotalMs, total);
+
+        platData->LatencyHistory[platData->LatencyHistoryHead] = total;
+        platData->LatencyHistoryHead = (platData->LatencyHistoryHead + 1) % InputLatencyHistorySize;
+        if (platData->LatencyHistoryCount < InputLatencyHistorySize)
+            platData->LatencyHistoryCount++;
+    }
+
+    platData->LatencyPending.resize(0);
+}
+
+#if defined(RLIMGUI_GLFW_EVENTS)
+// Input events captured from the GLFW callbacks as they arrive, so that clicks and drags between frames are not merged.
+// raylib's own callbacks are chained so raylib input keeps working as normal.
+struct QueuedInputEvent
+{
+    double Time;
+    AutomationEvent Event;
+};
+
+// single producer (the GLFW callbacks) single consumer (ProcessEvents) ring buffer
+struct InputEventQueue
+{
+    static constexpr unsigned int Capacity = 1024;
+
+    QueuedInputEvent Events[Capacity];
+    std::atomic<unsigned int> Head = { 0 };
+    std::atomic<unsigned int> Tail = { 0 };
+    std::atomic<unsigned int> Dropped = { 0 };
+
+    void Push(unsigned int type, int param0, int param1 = 0, int param2 = 0, int param3 = 0)
+    {
+        unsigned int head = Head.load(std::memory_order_relaxed);
+        if (head - Tail.load(std::memory_order_acquire) >= Capacity)
+        {
+            Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        QueuedInputEvent& queued = Events[head % Capacity];
+        queued.Time = GetTime();
+        queued.Event.frame = 0;
+        queued.Event.type = type;
+        queued.Event.params[0] = param0;
+        queued.Event.params[1] = param1;
+        queued.Event.params[2] = param2;
+        queued.Event.params[3] = param3;
+
+        Head.store(head + 1, std::memory_order_release);
+    }
+
+    bool Pop(QueuedInputEvent& queued)
+    {
+        unsigned int tail = Tail.load(std::memory_order_relaxed);
+        if (tail == Head.load(std::memory_order_acquire))
+            return false;
+
+        queued = Events[tail % Capacity];
+        Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+static InputEventQueue GlfwEventQueue;
+
+static GLFWwindow* GlfwCallbackWindow = nullptr;
+static GLFWcursorposfun PrevCursorPosCallback = nullptr;
+static GLFWmousebuttonfun PrevMouseButtonCallback = nullptr;
+static GLFWscrollfun PrevScrollCallback = nullptr;
+static GLFWkeyfun PrevKeyCallback = nullptr;
+static GLFWcharfun PrevCharCallback = nullptr;
+static GLFWwindowfocusfun PrevWindowFocusCallback = nullptr;
+static GLFWcursorenterfun PrevCursorEnterCallback = nullptr;
+
+// producer side state, only touched by the callbacks
+static bool GlfwWindowFocused = true;
+static int GlfwKeyMods = 0;
+
+static bool GlfwTrackMouse(void)
+{
+#if defined(RLIMGUI_ALWAYS_TRACK_MOUSE)
+    return true;
+#else
+    return GlfwWindowFocused;
+#endif
+}
+
+// raylib's SetMouseOffset and SetMouseScale have no getters, so the last cursor event is kept in both spaces to map positions read from GLFW
+static ImVec2 GlfwLastRawCursor = ImVec2(0, 0);
+static ImVec2 GlfwLastCursor = ImVec2(0, 0);
+static ImVec2 GlfwCursorScale = ImVec2(1, 1);
+static bool GlfwHasCursor = false;
+
+static ImVec2 GlfwMapCursor(double x, double y)
+{
+    if (!GlfwHasCursor)
+    {
+        Vector2 mouse = GetMousePosition();
+        return ImVec2(mouse.x, mouse.y);
+    }
+    return ImVec2(GlfwLastCursor.x + (float(x) - GlfwLastRawCursor.x) * GlfwCursorScale.x, GlfwLastCursor.y + (float(y) - GlfwLastRawCursor.y) * GlfwCursorScale.y);
+}
+
+static void GlfwCursorPosCallback(GLFWwindow* window, double x, double y)
+{
+    ImVec2 pos = ImVec2(float(x), float(y));
+    if (PrevCursorPosCallback)
+    {
+        // raylib's callback stores the position, so its mouse position is this event with the offset and scale applied
+        PrevCursorPosCallback(window, x, y);
+        Vector2 mouse = GetMousePosition();
+        pos = ImVec2(mouse.x, mouse.y);
+
+        if (GlfwHasCursor && float(x) != GlfwLastRawCursor.x)
+            GlfwCursorScale.x = (pos.x - GlfwLastCursor.x) / (float(x) - GlfwLastRawCursor.x);
+        if (GlfwHasCursor && float(y) != GlfwLastRawCursor.y)
+            GlfwCursorScale.y = (pos.y - GlfwLastCursor.y) / (float(y) - GlfwLastRawCursor.y);
+    }
+    GlfwLastRawCursor = ImVec2(float(x), float(y));
+    GlfwLastCursor = pos;
+    GlfwHasCursor = true;
+
+    if (GlfwTrackMouse())
+        GlfwEventQueue.Push(InputEvent_MousePos, FloatToParam(pos.x), FloatToParam(pos.y));
+}
+
+static void GlfwMouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+{
+    if (PrevMouseButtonCallback)
+        PrevMouseButtonCallback(window, button, action, mods);
+
+    if (!GlfwTrackMouse())
+        return;
+
+    // same mapping as the polled input, raylib's forward and back buttons are ImGui's extra buttons
+    int imGuiButton = -1;
+    switch (button)
+    {
+    case MOUSE_BUTTON_LEFT: imGuiButton = ImGuiMouseButton_Left; break;
+    case MOUSE_BUTTON_RIGHT: imGuiButton = ImGuiMouseButton_Right; break;
+    case MOUSE_BUTTON_MIDDLE: imGuiButton = ImGuiMouseButton_Middle; break;
+    case MOUSE_BUTTON_FORWARD: imGuiButton = ImGuiMouseButton_Middle + 1; break;
+    case MOUSE_BUTTON_BACK: imGuiButton = ImGuiMouseButton_Middle + 2; break;
+    default: break;
+    }
+
+    if (imGuiButton >= 0 && action != GLFW_REPEAT)
+        GlfwEventQueue.Push(InputEvent_MouseButton, imGuiButton, action == GLFW_PRESS);
+}
+
+static void GlfwScrollCallback(GLFWwindow* window, double x, double y)
+{
+    if (PrevScrollCallback)
+        PrevScrollCallback(window, x, y);
+
+    if (GlfwTrackMouse())
+        GlfwEventQueue.Push(InputEvent_MouseWheel, FloatToParam(float(x)), FloatToParam(float(y)));
+}
+
+static void GlfwUpdateKeyMod(int mods, int modFlag, ImGuiKey modKey)
+{
+    if ((mods & modFlag) == (GlfwKeyMods & modFlag))
+        return;
+
+    GlfwEventQueue.Push(InputEvent_Key, modKey, (mods & modFlag) != 0);
+}
+
+static void GlfwKeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    if (PrevKeyCallback)
+        PrevKeyCallback(window, key, scancode, action, mods);
+
+    if (action == GLFW_REPEAT)
+        return;
+
+    // some platforms report the modifiers from before the modifier key itself changed
+    bool down = action == GLFW_PRESS;
+    if (key == KEY_LEFT_CONTROL || key == KEY_RIGHT_CONTROL)
+        mods = down ? (mods | GLFW_MOD_CONTROL) : (mods & ~GLFW_MOD_CONTROL);
+    else if (key == KEY_LEFT_SHIFT || key == KEY_RIGHT_SHIFT)
+        mods = down ? (mods | GLFW_MOD_SHIFT) : (mods & ~GLFW_MOD_SHIFT);
+    else if (key == KEY_LEFT_ALT || key == KEY_RIGHT_ALT)
+        mods = down ? (mods | GLFW_MOD_ALT) : (mods & ~GLFW_MOD_ALT);
+    else if (key == KEY_LEFT_SUPER || key == KEY_RIGHT_SUPER)
+        mods = down ? (mods | GLFW_MOD_SUPER) : (mods & ~GLFW_MOD_SUPER);
+
+    GlfwUpdateKeyMod(mods, GLFW_MOD_CONTROL, ImGuiMod_Ctrl);
+    GlfwUpdateKeyMod(mods, GLFW_MOD_SHIFT, ImGuiMod_Shift);
+    GlfwUpdateKeyMod(mods, GLFW_MOD_ALT, ImGuiMod_Alt);
+    GlfwUpdateKeyMod(mods, GLFW_MOD_SUPER, ImGuiMod_Super);
+    GlfwKeyMods = mods;
+
+    ImGuiKey imGuiKey = ImGui_ImplRaylib_KeyToImGuiKey(key);
+    if (imGuiKey != ImGuiKey_None)
+        GlfwEventQueue.Push(InputEvent_Key, imGuiKey, down);
+}
+
+static void GlfwCharCallback(GLFWwindow* window, unsigned int codepoint)
+{
+    if (PrevCharCallback)
+        PrevCharCallback(window, codepoint);
+
+    GlfwEventQueue.Push(InputEvent_Char, int(codepoint));
+}
+
+static void GlfwWindowFocusCallback(GLFWwindow* window, int focused)
+{
+    if (PrevWindowFocusCallback)
+        PrevWindowFocusCallback(window, focused);
+
+    GlfwWindowFocused = focused != 0;
+    GlfwEventQueue.Push(InputEvent_Focus, focused != 0);
+
+    if (!GlfwTrackMouse())
+        GlfwEventQueue.Push(InputEvent_MousePos, FloatToParam(-std::numeric_limits<float>::max()), FloatToParam(-std::numeric_limits<float>::max()));
+}
+
+static void GlfwCursorEnterCallback(GLFWwindow* window, int entered)
+{
+    if (PrevCursorEnterCallback)
+        PrevCursorEnterCallback(window, entered);
+
+    if (!entered)
+        GlfwEventQueue.Push(InputEvent_MousePos, FloatToParam(-std::numeric_limits<float>::max()), FloatToParam(-std::numeric_limits<float>::max()));
+}
+
+static void InstallGlfwCallbacks(void)
+{
+    if (GlfwCallbackWindow)
+        return;
+
+    GlfwCallbackWindow = (GLFWwindow*)GetWindowHandle();
+    if (!GlfwCallbackWindow)
+        return;
+
+    GlfwWindowFocused = IsWindowFocused();
+    GlfwKeyMods = 0;
+
+    PrevCursorPosCallback = glfwSetCursorPosCallback(GlfwCallbackWindow, GlfwCursorPosCallback);
+    PrevMouseButtonCallback = glfwSetMouseButtonCallback(GlfwCallbackWindow, GlfwMouseButtonCallback);
+    PrevScrollCallback = glfwSetScrollCallback(GlfwCallbackWindow, GlfwScrollCallback);
+    PrevKeyCallback = glfwSetKeyCallback(GlfwCallbackWindow, GlfwKeyCallback);
+    PrevCharCallback = glfwSetCharCallback(GlfwCallbackWindow, GlfwCharCallback);
+    PrevWindowFocusCallback = glfwSetWindowFocusCallback(GlfwCallbackWindow, GlfwWindowFocusCallback);
+    PrevCursorEnterCallback = glfwSetCursorEnterCallback(GlfwCallbackWindow, GlfwCursorEnterCallback);
+}
+
+static void RemoveGlfwCallbacks(void)
+{
+    if (!GlfwCallbackWindow)
+        return;
+
+    glfwSetCursorPosCallback(GlfwCallbackWindow, PrevCursorPosCallback);
+    glfwSetMouseButtonCallback(GlfwCallbackWindow, PrevMouseButtonCallback);
+    glfwSetScrollCallback(GlfwCallbackWindow, PrevScrollCallback);
+    glfwSetKeyCallback(GlfwCallbackWindow, PrevKeyCallback);
+    glfwSetCharCallback(GlfwCallbackWindow, PrevCharCallback);
+    glfwSetWindowFocusCallback(GlfwCallbackWindow, PrevWindowFocusCallback);
+    glfwSetCursorEnterCallback(GlfwCallbackWindow, PrevCursorEnterCallback);
+    GlfwCallbackWindow = nullptr;
+    GlfwHasCursor = false;
+    GlfwCursorScale = ImVec2(1, 1);
+
+    // drop anything that was not sent yet
+    QueuedInputEvent queued;
+    while (GlfwEventQueue.Pop(queued)) {}
+}
+#endif // RLIMGUI_GLFW_EVENTS
+
+// reads the cursor position right now, raylib's mouse position is only updated when it polls events at the end of the frame
+static bool GetLatestMousePos(ImVec2& pos)
+{
+    bool trackMouse = IsWindowFocused();
+#if defined(RLIMGUI_ALWAYS_TRACK_MOUSE)
+    trackMouse = true;
+#endif
+    if (!trackMouse)
+        return false;
+
+#if defined(RLIMGUI_GLFW_EVENTS)
+    if (GlfwCallbackWindow)
+    {
+        double x = 0, y = 0;
+        glfwGetCursorPos(GlfwCallbackWindow, &x, &y);
+        pos = GlfwMapCursor(x, y);
+        return true;
+    }
+#endif
+
+    Vector2 mouse = GetMousePosition();
+    pos = ImVec2(mouse.x, mouse.y);
+    return true;
+}
+
+
+Vector2 GetDisplayScale()
+{
+#if defined(__EMSCRIPTEN__)
+    return Vector2{ 1,1 };
+#else
+    return GetWindowScaleDPI();
+#endif
+}
+
+static const char* GetClipTextCallback(ImGuiContext*)
+{
+    return GetClipboardText();
+}
+
+static void SetClipTextCallback(ImGuiContext*, const char* text)
+{
+    SetClipboardText(text);
+}
+
+static void ImGuiNewFrame(float deltaTime)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    auto* platData = ImGui_ImplRaylib_GetBackendData();
+    if (!platData)
+    {
+        ImGui_ImplRaylib_CreateBackendData();
+        platData = ImGui_ImplRaylib_GetBackendData();
+        if (!platData)
+            return;
+    }
+
+    Vector2 resolutionScale = GetDisplayScale();
+
+    if (platData->HasTarget)
+    {
+        io.DisplaySize.x = float(platData->Target.texture.width);
+        io.DisplaySize.y = float(platData->Target.texture.height);
+        resolutionScale = Vector2{ 1,1 };
+    }
+    else
+    {
+#ifndef PLATFORM_DRM
+        if (IsWindowFullscreen())
+        {
+            int monitor = GetCurrentMonitor();
+            io.DisplaySize.x = float(GetMonitorWidth(monitor));
+            io.DisplaySize.y = float(GetMonitorHeight(monitor));
+        }
+        else
+        {
+            io.DisplaySize.x = float(GetScreenWidth());
+            io.DisplaySize.y = float(GetScreenHeight());
+        }
+
+#if !defined(__APPLE__)
+        if (!IsWindowState(FLAG_WINDOW_HIGHDPI))
+            resolutionScale = Vector2{ 1,1 };
+#endif
+#else
+        io.DisplaySize.x = float(GetScreenWidth());
+        io.DisplaySize.y = float(GetScreenHeight());
+#endif
+    }
+
+    io.DisplayFramebufferScale = ImVec2(resolutionScale.x, resolutionScale.y);
+
+    if (deltaTime <= 0)
+        deltaTime = 0.001f;
+
+    io.DeltaTime = deltaTime;
+
+    // contexts that draw to a render texture or get no input leave the OS cursor alone
+    if ((ImGui::GetIO().BackendFlags & ImGuiBackendFlags_HasMouseCursors) && platData->InputEnabled && !platData->HasTarget)
+    {
+        if ((io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange) == 0)
+        {
+            ImGuiMouseCursor imgui_cursor = ImGui::GetMouseCursor();
+            if (imgui_cursor != platData->CurrentMouseCursor || io.MouseDrawCursor || platData->LateSoftwareCursor)
+            {
+                platData->CurrentMouseCursor = imgui_cursor;
+                if (io.MouseDrawCursor || platData->LateSoftwareCursor || imgui_cursor == ImGuiMouseCursor_None)
+                {
+                    HideCursor();
+                }
+                else
+                {
+                    ShowCursor();
+
+                    if (!(io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange))
+                    {
+                        SetMouseCursor((imgui_cursor > -1 && imgui_cursor < ImGuiMouseCursor_COUNT) ? MouseCursorMap[imgui_cursor] : MOUSE_CURSOR_DEFAULT);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void ImGuiTriangleVert(const ImDrawVert& idx_vert)
+{
+#ifdef __cpp_designated_initializers
+    Color c {
+       .r = static_cast<unsigned char>(idx_vert.col>>0),
+       .g = static_cast<unsigned char>(idx_vert.col>>8),
+       .b = static_cast<unsigned char>(idx_vert.col>>16),
+       .a = static_cast<unsigned char>(idx_vert.col>>24),
+    };
+#else
+    Color c {
+       static_cast<unsigned char>(idx_vert.col>>0),
+       static_cast<unsigned char>(idx_vert.col>>8),
+       static_cast<unsigned char>(idx_vert.col>>16),
+       static_cast<unsigned char>(idx_vert.col>>24),
+    };
+#endif
+    rlColor4ub(c.r, c.g, c.b, c.a);
+    rlTexCoord2f(idx_vert.uv.x, idx_vert.uv.y);
+    rlVertex2f(idx_vert.pos.x, idx_vert.pos.y);
+}
+
+static void ImGuiRenderTriangles(unsigned int count, int indexStart, const ImVector<ImDrawIdx>& indexBuffer, const ImVector<ImDrawVert>& vertBuffer, ImTextureID texturePtr)
+{
+    if (count < 3)
+        return;
+
+    unsigned int textureId = static_cast<unsigned int>(texturePtr);
+
+    rlBegin(RL_TRIANGLES);
+    rlSetTexture(textureId);
+
+    for (unsigned int i = 0; i <= (count - 3); i += 3)
+    {
+        ImDrawIdx indexA = indexBuffer[indexStart + i];
+        ImDrawIdx indexB = indexBuffer[indexStart + i + 1];
+        ImDrawIdx indexC = indexBuffer[indexStart + i + 2];
+
+        ImDrawVert vertexA = vertBuffer[indexA];
+        ImDrawVert vertexB = vertBuffer[indexB];
+        ImDrawVert vertexC = vertBuffer[indexC];
+
+        ImGuiTriangleVert(vertexA);
+        ImGuiTriangleVert(vertexB);
+        ImGuiTriangleVert(vertexC);
+    }
+    rlEnd();
+}
+
+// ImGui units to framebuffer pixels
+static ImVec2 GetFramebufferScale(void)
+{
+    ImVec2 scale = ImGui::GetIO().DisplayFramebufferScale;
+#if !defined(__APPLE__)
+    if (!IsWindowState(FLAG_WINDOW_HIGHDPI))
+    {
+        scale.x = 1;
+        scale.y = 1;
+    }
+#endif
+    return scale;
+}
+
+static void EnableScissor(float x, float y, float width, float height)
+{
+    rlEnableScissorTest();
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImVec2 scale = GetFramebufferScale();
+
+    rlScissor((int)(x * scale.x),
+        int((io.DisplaySize.y - (int)(y + height)) * scale.y),
+        (int)(width * scale.x),
+        (int)(height * scale.y));
+}
+
+// image options
+// the options are draw callbacks that are never called, the renderer finds them by this function and keeps the options they ask for.
+// The shader and texture samplers are only changed when a draw needs something different than what is already set.
+static void ImageOptionsCallback(const ImDrawList*, const ImDrawCmd*)
+{
+}
+
+// the filter and wrap textures go back to after they are drawn with other options, packed into an int.
+// Only textures set with rlImGuiSetTextureSampler are known, the sampler of any other texture is never changed
+static ImGuiStorage TextureSamplers;
+
+static constexpr int SamplerKnown = 1 << 16;
+static constexpr int SamplerMipmaps = 1 << 17;
+static constexpr int SamplerWarned = 1 << 18;       // an unknown texture that was already warned about
+
+static int PackSampler(int filter, int wrap, bool mipmaps)
+{
+    return SamplerKnown | (mipmaps ? SamplerMipmaps : 0) | ((wrap & 0xFF) << 8) | (filter & 0xFF);
+}
+
+static int GetTextureSampler(unsigned int textureId)
+{
+    return TextureSamplers.GetInt(textureId, 0);
+}
+
+static void SetTextureSampler(unsigned int textureId, int sampler)
+{
+    Texture texture = { 0 };
+    texture.id = textureId;
+    texture.mipmaps = (sampler & SamplerMipmaps) ? 2 : 1;
+
+    SetTextureFilter(texture, sampler & 0xFF);
+    SetTextureWrap(texture, (sampler >> 8) & 0xFF);
+}
+
+struct AppliedSampler
+{
+    unsigned int TextureId = 0;
+    int Sampler = 0;
+};
+
+static rlImGuiImageOptions RenderImageOptions = { -1, -1, { 0 } };
+static unsigned int RenderShaderId = 0;
+static ImVector<AppliedSampler> RenderSamplers;     // textures that are not set to their own sampler
+static rlImGuiImageOptionsStats RenderStateStats = { 0 };
+
+// the draw data being rendered, for callbacks that need to know where the screen is
+static ImVec2 RenderDisplayPos = ImVec2(0, 0);
+static ImVec2 RenderDisplaySize = ImVec2(0, 0);
+static rlImGuiSceneStats SceneStats = { 0 };
+
+// options pushed by rlImGuiPushImageOptions, with the draw list they were pushed into
+struct ImageOptionsEntry
+{
+    rlImGuiImageOptions Options;
+    ImDrawList* DrawList;
+};
+
+static ImVector<ImageOptionsEntry> ImageOptionsStack;
+
+static void EndRenderShader(void)
+{
+    if (RenderShaderId == 0)
+        return;
+
+    rlDrawRenderBatchActive();
+    EndShaderMode();
+    RenderShaderId = 0;
+    RenderStateStats.ShaderChanges++;
+}
+
+static void ApplyImageRenderState(const ImDrawCmd& cmd)
+{
+    // textures made by ImGui are the font atlas, they keep their sampler and need the distance field shader in SDF mode
+    bool imguiTexture = cmd.TexRef._TexData != nullptr;
+
+    Shader shader = RenderImageOptions.DrawShader;
+    Shader sdfShader = { 0 };
+    if (imguiTexture && GetSdfFontShader(sdfShader))
+        shader = sdfShader;
+
+    // every command is flushed after it is drawn, so nothing is waiting on the old state
+    if (shader.id != RenderShaderId)
+    {
+        if (shader.id == 0)
+        {
+            EndRenderShader();
+        }
+        else
+        {
+            BeginShaderMode(shader);
+            RenderShaderId = shader.id;
+            RenderStateStats.ShaderChanges++;
+        }
+    }
+
+    if (imguiTexture)
+        return;
+
+    if (RenderImageOptions.Filter < 0 && RenderImageOptions.Wrap < 0 && RenderSamplers.empty())
+        return;
+
+    // raylib can not tell what a texture is set to, so a texture that was not set through rlImGui can not be put back
+    unsigned int textureId = static_cast<unsigned int>(cmd.GetTexID());
+    int own = GetTextureSampler(textureId);
+    if ((own & SamplerKnown) == 0)
+    {
+        if ((RenderImageOptions.Filter >= 0 || RenderImageOptions.Wrap >= 0) && own == 0)
+        {
+            TraceLog(LOG_WARNING, "RLIMGUI: [ID %u] Set the texture with rlImGuiSetTextureSampler to draw it with another filter or wrap", textureId);
+            TextureSamplers.SetInt(textureId, SamplerWarned);
+        }
+        return;
+    }
+
+    int wanted = own;
+    if (RenderImageOptions.Filter >= 0 || RenderImageOptions.Wrap >= 0)
+    {
+        int filter = RenderImageOptions.Filter >= 0 ? RenderImageOptions.Filter : (own & 0xFF);
+        int wrap = RenderImageOptions.Wrap >= 0 ? RenderImageOptions.Wrap : ((own >> 8) & 0xFF);
+        wanted = PackSampler(filter, wrap, (own & SamplerMipmaps) != 0);
+    }
+
+    int applied = -1;
+    for (int i = 0; i < RenderSamplers.Size; i++)
+    {
+        if (RenderSamplers[i].TextureId == textureId)
+        {
+            applied = i;
+            break;
+        }
+    }
+
+    int current = applied >= 0 ? RenderSamplers[applied].Sampler : own;
+    if (wanted == current)
+        return;
+
+    SetTextureSampler(textureId, wanted);
+    RenderStateStats.SamplerChanges++;
+
+    if (wanted == own)
+    {
+        RenderSamplers.erase(RenderSamplers.begin() + applied);
+    }
+    else if (applied >= 0)
+    {
+        RenderSamplers[applied].Sampler = wanted;
+    }
+    else
+    {
+        AppliedSampler entry;
+        entry.TextureId = textureId;
+        entry.Sampler = wanted;
+        RenderSamplers.push_back(entry);
+    }
+}
+
+// back to the state ImGui draws with, for ImDrawCallback_ResetRenderState and after user callbacks
+static void ResetImageRenderState(void)
+{
+    rlDrawRenderBatchActive();
+    EndRenderShader();
+    rlSetTexture(0);
+    rlDisableBackfaceCulling();
+    RenderImageOptions = rlImGuiDefaultImageOptions();
+}
+
+static void RestoreImageRenderState(void)
+{
+    EndRenderShader();
+
+    for (const AppliedSampler& entry : RenderSamplers)
+        SetTextureSampler(entry.TextureId, GetTextureSampler(entry.TextureId));
+    RenderSamplers.clear();
+
+    RenderImageOptions = rlImGuiDefaultImageOptions();
+}
+
+static void SetupMouseCursors(void)
+{
+    MouseCursorMap[ImGuiMouseCursor_Arrow] = MOUSE_CURSOR_ARROW;
+    MouseCursorMap[ImGuiMouseCursor_TextInput] = MOUSE_CURSOR_IBEAM;
+    MouseCursorMap[ImGuiMouseCursor_Hand] = MOUSE_CURSOR_POINTING_HAND;
+    MouseCursorMap[ImGuiMouseCursor_ResizeAll] = MOUSE_CURSOR_RESIZE_ALL;
+    MouseCursorMap[ImGuiMouseCursor_ResizeEW] = MOUSE_CURSOR_RESIZE_EW;
+    MouseCursorMap[ImGuiMouseCursor_ResizeNESW] = MOUSE_CURSOR_RESIZE_NESW;
+    MouseCursorMap[ImGuiMouseCursor_ResizeNS] = MOUSE_CURSOR_RESIZE_NS;
+    MouseCursorMap[ImGuiMouseCursor_ResizeNWSE] = MOUSE_CURSOR_RESIZE_NWSE;
+    MouseCursorMap[ImGuiMouseCursor_NotAllowed] = MOUSE_CURSOR_NOT_ALLOWED;
+}
+
+// the display scale is read on the main thread, so fonts can also be added to an atlas on a worker thread
+struct FontSetupScale
+{
+    float Size = 1;
+    float RasterizerMultiply = 1;
+};
+
+static FontSetupScale GetFontSetupScale(void)
+{
+    FontSetupScale scale;
+#if !defined(__APPLE__)
+    if (!IsWindowState(FLAG_WINDOW_HIGHDPI))
+        scale.Size = GetDisplayScale().y;
+
+    scale.RasterizerMultiply = GetDisplayScale().y;
+#endif
+    return scale;
+}
+
+static void AddDefaultFont(ImFontAtlas* atlas, const FontSetupScale& scale)
+{
+    ImFontConfig defaultConfig;
+
+    static constexpr int DefaultFonSize = 13;
+
+    defaultConfig.SizePixels = ceilf(DefaultFonSize * scale.Size);
+    defaultConfig.RasterizerMultiply = scale.RasterizerMultiply;
+
+    defaultConfig.PixelSnapH = true;
+    atlas->AddFontDefault(&defaultConfig);
+}
+
+static void AddFontAwesome(ImFontAtlas* atlas, const FontSetupScale& scale)
+{
+#ifndef NO_FONT_AWESOME
+    static const ImWchar icons_ranges[] = { ICON_MIN_FA, ICON_MAX_FA, 0 };
+    ImFontConfig icons_config;
+    icons_config.MergeMode = true;
+    icons_config.PixelSnapH = true;
+    icons_config.FontDataOwnedByAtlas = false;
+
+    icons_config.GlyphMaxAdvanceX = std::numeric_limits<float>::max();
+    icons_config.RasterizerMultiply = 1.0f;
+    icons_config.OversampleH = 2;
+    icons_config.OversampleV = 1;
+
+    icons_config.GlyphRanges = icons_ranges;
+
+    float size = FONT_AWESOME_ICON_SIZE * scale.Size;
+    icons_config.RasterizerMultiply = scale.RasterizerMultiply;
+
+#if defined(RLIMGUI_FA_RAW_DATA)
+    // the atlas reads the font straight from the read only data, there is nothing to decompress or copy
+    atlas->AddFontFromMemoryTTF((void*)fa_solid_900_raw_data, int(fa_solid_900_raw_size), size, &icons_config, icons_ranges);
+#else
+    // the font cache keeps the decompressed font, so a warm start skips the decompression
+    const void* cachedData = nullptr;
+    int cachedSize = 0;
+    ImGuiID cacheKey = 0;
+    if (ActiveFontCache)
+    {
+        cacheKey = ImHashData(fa_solid_900_compressed_data, fa_solid_900_compressed_size);
+        cachedData = FindFontCacheBlob(ActiveFontCache, cacheKey, &cachedSize);
+    }
+
+    if (cachedData)
+    {
+        atlas->AddFontFromMemoryTTF((void*)cachedData, cachedSize, size, &icons_config, icons_ranges);
+    }
+    else
+    {
+        atlas->AddFontFromMemoryCompressedTTF((void*)fa_solid_900_compressed_data, fa_solid_900_compressed_size, size, &icons_config, icons_ranges);
+        if (ActiveFontCache && !atlas->Sources.empty())
+            AddFontCacheBlob(ActiveFontCache, cacheKey, atlas->Sources.back().FontData, atlas->Sources.back().FontDataSize);
+    }
+#endif // RLIMGUI_FA_RAW_DATA
+#endif
+}
+
+void SetupFontAwesome(void)
+{
+    AddFontAwesome(ImGui::GetIO().Fonts, GetFontSetupScale());
+}
+
+void SetupBackend(void)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = "imgui_impl_raylib";
+    io.BackendFlags |= ImGuiBackendFlags_HasGamepad | ImGuiBackendFlags_HasSetMousePos | ImGuiBackendFlags_RendererHasTextures;
+
+#ifndef PLATFORM_DRM
+    io.BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
+#endif
+
+    io.MousePos = ImVec2(0, 0);
+
+    ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+
+    platformIO.Platform_SetClipboardTextFn = SetClipTextCallback;
+    platformIO.Platform_GetClipboardTextFn = GetClipTextCallback;
+
+    platformIO.Platform_ClipboardUserData = nullptr;
+
+    ImGui_ImplRaylib_CreateBackendData();
+
+#if defined(RLIMGUI_GLFW_EVENTS)
+    InstallGlfwCallbacks();
+#endif
+}
+
+void rlImGuiEndInitImGui(void)
+{
+    ImGui::SetCurrentContext(GlobalContext);
+
+    if (!SharedFontAtlasHasFonts)
+    {
+        double start = GetTime();
+        SetupFontAwesome();
+        LockSdfFontSizes(SharedFontAtlas);
+        TextureStats.FontSetupSeconds += GetTime() - start;
+        SharedFontAtlasHasFonts = true;
+
+        // bake the glyphs the last session used, so they are in the atlas when it is first uploaded
+        if (GlyphRecordFileName)
+            PrewarmRecordedGlyphs(SharedFontAtlas);
+    }
+
+    SetupMouseCursors();
+
+    SetupBackend();
+}
+
+void rlImGuiBeginInitImGui(void)
+{
+    // an async setup that is still running makes the default context when it finishes
+    FinishAsyncSetup(true);
+
+    if (GlobalContext == nullptr)
+        GlobalContext = ImGui::CreateContext(AcquireSharedFontAtlas());
+
+    ImGui::SetCurrentContext(GlobalContext);
+
+    // a context that is still alive already set up the shared fonts
+    if (SharedFontAtlasHasFonts)
+        return;
+
+    double start = GetTime();
+    AddDefaultFont(ImGui::GetIO().Fonts, GetFontSetupScale());
+    TextureStats.FontSetupSeconds = GetTime() - start;
+}
+
+void rlImGuiSetup(bool dark)
+{
+    rlImGuiBeginInitImGui();
+
+    if (dark)
+        ImGui::StyleColorsDark();
+    else
+        ImGui::StyleColorsLight();
+
+    rlImGuiEndInitImGui();
+}
+
+// async setup, the shared atlas is built on a worker thread and the default context is made once it is done.
+// nothing else uses the new atlas until then, and the worker does not call raylib window functions or use an ImGui context
+struct AsyncFontSetup
+{
+#if !defined(RLIMGUI_NO_THREADS)
+    std::thread Worker;
+#endif
+    std::atomic<bool> Done{ false };
+    ImFontAtlas* Atlas = nullptr;
+    FontSetupScale Scale;
+    bool Dark = true;
+    double Seconds = 0;
+};
+
+static void BuildAsyncFonts(AsyncFontSetup* setup)
+{
+    double start = GetTime();
+    AddDefaultFont(setup->Atlas, setup->Scale);
+    AddFontAwesome(setup->Atlas, setup->Scale);
+    LockSdfFontSizes(setup->Atlas);
+    setup->Seconds = GetTime() - start;
+
+    if (GlyphRecordFileName)
+        PrewarmRecordedGlyphs(setup->Atlas);
+
+    setup->Done.store(true, std::memory_order_release);
+}
+
+void rlImGuiSetupAsync(bool dark)
+{
+    if (GlobalContext || PendingFontSetup)
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: rlImGuiSetupAsync must be called before rlImGui is set up");
+        return;
+    }
+
+    PendingFontSetup = IM_NEW(AsyncFontSetup)();
+    PendingFontSetup->Atlas = CreateFontAtlas();
+    PendingFontSetup->Scale = GetFontSetupScale();
+    PendingFontSetup->Dark = dark;
+
+#if defined(RLIMGUI_NO_THREADS)
+    BuildAsyncFonts(PendingFontSetup);
+#else
+    PendingFontSetup->Worker = std::thread(BuildAsyncFonts, PendingFontSetup);
+#endif
+}
+
+static bool FinishAsyncSetup(bool wait)
+{
+    if (!PendingFontSetup)
+        return true;
+
+    if (!wait && !PendingFontSetup->Done.load(std::memory_order_acquire))
+        return false;
+
+    AsyncFontSetup* setup = PendingFontSetup;
+#if !defined(RLIMGUI_NO_THREADS)
+    setup->Worker.join();
+#endif
+    PendingFontSetup = nullptr;
+
+    // the finished atlas becomes the shared atlas, so the normal setup does not add the fonts again
+    SetSharedFontAtlas(setup->Atlas, true);
+    TextureStats.FontSetupSeconds = setup->Seconds;
+
+    bool dark = setup->Dark;
+    IM_DELETE(setup);
+
+    rlImGuiSetup(dark);
+    return true;
+}
+
+bool rlImGuiIsReady(void)
+{
+    return FinishAsyncSetup(false) && GlobalContext != nullptr;
+}
+
+static void UpdateImageAtlas(void);
+static void EndImageAtlasFrame(void);
+static void EndRenderTexturePoolFrame(void);
+static void EndLargeImageFrame(void);
+static void EndStreamTextureFrame(void);
+
+// work on state shared by every context, only done when no context is inside a frame
+static void UpdateSharedFrameState(void)
+{
+    UpdateFontAtlasBudget();
+}
+
+// the outermost extra contexts that began since the shared frame last ended
+static ImVector<ImGuiContext*> SharedFrameContexts;
+
+// the once a frame work on shared state, done by rlImGuiEnd, or by extra contexts in apps that do not use the default context
+static void EndSharedFrame(void)
+{
+    SharedFrameContexts.clear();
+    UpdateImageAtlas();
+    EndImageAtlasFrame();
+    EndRenderTexturePoolFrame();
+    EndLargeImageFrame();
+    EndStreamTextureFrame();
+}
+
+void rlImGuiBegin(void)
+{
+    FinishAsyncSetup(true);
+    ImGui::SetCurrentContext(GlobalContext);
+    rlImGuiBeginDelta(GetFrameTime());
+}
+
+void rlImGuiBeginDelta(float deltaTime)
+{
+    FinishAsyncSetup(true);
+
+    if (FrameContext == nullptr)
+        UpdateSharedFrameState();
+
+    ImGui::SetCurrentContext(GlobalContext);
+    FrameContext = GlobalContext;
+
+    ImGuiNewFrame(deltaTime);
+    ImGui_ImplRaylib_ProcessEvents();
+    ImGui::NewFrame();
+    PrewarmPendingGlyphs();
+}
+
+void rlImGuiEnd(void)
+{
+    ImGui::SetCurrentContext(GlobalContext);
+    ImGui::Render();
+    ImGui_ImplRaylib_RenderDrawData(ImGui::GetDrawData());
+    FrameContext = nullptr;
+    EndSharedFrame();
+
+    if (!ImageOptionsStack.empty())
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: %d image options were pushed and not popped", ImageOptionsStack.Size);
+        ImageOptionsStack.clear();
+    }
+}
+
+// extra contexts
+struct rlImGuiContext
+{
+    ImGuiContext* Context = nullptr;
+    ImGuiContext* PreviousFrameContext = nullptr;
+};
+
+static ImVector<rlImGuiContext*> ExtraContexts;
+
+rlImGuiContext* rlImGuiCreateContext(bool darkTheme)
+{
+    // extra contexts share the atlas that is still being built
+    FinishAsyncSetup(true);
+
+    if (GlobalContext == nullptr)
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: Call rlImGuiSetup before creating extra contexts");
+        return nullptr;
+    }
+
+    ImGuiContext* previous = ImGui::GetCurrentContext();
+
+    rlImGuiContext* context = IM_NEW(rlImGuiContext)();
+    context->Context = ImGui::CreateContext(AcquireSharedFontAtlas());
+    ImGui::SetCurrentContext(context->Context);
+
+    if (darkTheme)
+        ImGui::StyleColorsDark();
+    else
+        ImGui::StyleColorsLight();
+
+    // the default context owns imgui.ini
+    ImGui::GetIO().IniFilename = nullptr;
+
+    SetupBackend();
+
+    ExtraContexts.push_back(context);
+
+    ImGui::SetCurrentContext(previous);
+    return context;
+}
+
+void rlImGuiDestroyContext(rlImGuiContext* context)
+{
+    if (!context)
+        return;
+
+    ImGuiContext* previous = ImGui::GetCurrentContext();
+
+    ImGui::SetCurrentContext(context->Context);
+    ImGui_ImplRaylib_Shutdown();
+    SharedFrameContexts.find_erase_unsorted(context->Context);
+    ImGui::DestroyContext(context->Context);
+    ReleaseSharedFontAtlas();
+
+    if (FrameContext == context->Context)
+        FrameContext = nullptr;
+
+    ImGui::SetCurrentContext(previous != context->Context ? previous : GlobalContext);
+
+    ExtraContexts.find_erase_unsorted(context);
+    IM_DELETE(context);
+}
+
+void rlImGuiSetContextTarget(rlImGuiContext* context, const RenderTexture* target)
+{
+    if (!context)
+        return;
+
+    ImGuiContext* previous = ImGui::GetCurrentContext();
+    ImGui::SetCurrentContext(context->Context);
+
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (platData)
+    {
+        platData->HasTarget = target != nullptr;
+        platData->Target = target ? *target : RenderTexture{ 0 };
+    }
+
+    ImGui::SetCurrentContext(previous);
+}
+
+void rlImGuiSetContextInput(rlImGuiContext* context, bool enabled, const Rectangle* screenRect)
+{
+    if (!context)
+        return;
+
+    ImGuiContext* previous = ImGui::GetCurrentContext();
+    ImGui::SetCurrentContext(context->Context);
+
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (platData)
+    {
+        platData->InputEnabled = enabled;
+        platData->HasInputRect = screenRect != nullptr;
+        platData->InputRect = screenRect ? *screenRect : Rectangle{ 0, 0, 0, 0 };
+    }
+
+    ImGui::SetCurrentContext(previous);
+}
+
+void rlImGuiBeginContext(rlImGuiContext* context)
+{
+    rlImGuiBeginContextDelta(context, GetFrameTime());
+}
+
+void rlImGuiBeginContextDelta(rlImGuiContext* context, float deltaTime)
+{
+    if (!context)
+        return;
+
+    if (FrameContext == nullptr)
+    {
+        // an extra context that begins again with no rlImGuiEnd in between means the last raylib frame is over
+        if (SharedFrameContexts.contains(context->Context))
+            EndSharedFrame();
+        SharedFrameContexts.push_back(context->Context);
+
+        UpdateSharedFrameState();
+    }
+
+    context->PreviousFrameContext = FrameContext;
+    FrameContext = context->Context;
+    ImGui::SetCurrentContext(context->Context);
+
+    ImGuiNewFrame(deltaTime);
+    ImGui_ImplRaylib_ProcessEvents();
+    ImGui::NewFrame();
+    PrewarmPendingGlyphs();
+}
+
+void rlImGuiEndContext(rlImGuiContext* context)
+{
+    if (!context)
+        return;
+
+    ImGui::SetCurrentContext(context->Context);
+    ImGui::Render();
+
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (platData && platData->HasTarget)
+    {
+        BeginTextureMode(platData->Target);
+        ClearBackground(BLANK);
+        ImGui_ImplRaylib_RenderDrawData(ImGui::GetDrawData());
+        EndTextureMode();
+    }
+    else
+    {
+        ImGui_ImplRaylib_RenderDrawData(ImGui::GetDrawData());
+    }
+
+    // go back to whatever frame was being built when this one started
+    FrameContext = context->PreviousFrameContext;
+    context->PreviousFrameContext = nullptr;
+    SetFrameContext();
+}
+
+static void DestroyWorldPanels(void);
+static void DestroyImageAtlas(void);
+static void DestroyViewports(void);
+static void DestroyRenderTexturePool(void);
+static void DestroyLargeImages(void);
+static void DestroyStreamTextures(void);
+
+void rlImGuiShutdown(void)
+{
+    FinishAsyncSetup(true);
+
+    if (GlobalContext == nullptr)
+        return;
+
+    // the glyphs are saved while the atlas is still alive
+    if (GlyphRecordFileName)
+    {
+        rlImGuiSaveGlyphRecord();
+        MemFree(GlyphRecordFileName);
+        GlyphRecordFileName = nullptr;
+    }
+
+    DestroyWorldPanels();
+    DestroyImageAtlas();
+    DestroyViewports();
+    DestroyRenderTexturePool();
+    DestroyLargeImages();
+    DestroyStreamTextures();
+
+    while (!ExtraContexts.empty())
+        rlImGuiDestroyContext(ExtraContexts.back());
+    ExtraContexts.clear();
+
+    ImGui::SetCurrentContext(GlobalContext);
+    ImGui_ImplRaylib_Shutdown();
+
+    ImGui::DestroyContext(GlobalContext);
+    ReleaseSharedFontAtlas();
+    GlobalContext = nullptr;
+
+    // glyphs baked this run are kept for the next launch
+    rlImGuiSaveFontCache();
+    DestroyFontCache();
+
+    UnloadSdfFontShader();
+
+    ImageOptionsStack.clear();
+    SharedFrameContexts.clear();
+    TextureSamplers.Clear();
+    PolledInputs.clear();
+    PolledInputStart = 0;
+    memset(PolledKeysDown, 0, sizeof(PolledKeysDown));
+    PolledMouseButtonsDown = 0;
+}
+
+void rlImGuiImage(const Texture* image)
+{
+    if (!image)
+        return;
+    
+    SetFrameContext();
+    
+    ImGui::Image(ImTextureID(image->id), ImVec2(float(image->width), float(image->height)));
+}
+
+bool rlImGuiImageButton(const char* name, const Texture* image)
+{
+    if (!image)
+        return false;
+    
+    SetFrameContext();
+    
+    return ImGui::ImageButton(name, ImTextureID(image->id), ImVec2(float(image->width), float(image->height)));
+}
+
+bool rlImGuiImageButtonSize(const char* name, const Texture* image, Vector2 size)
+{
+    if (!image)
+        return false;
+    
+    SetFrameContext();
+   
+    return ImGui::ImageButton(name, ImTextureID(image->id), ImVec2(size.x, size.y));
+}
+
+void rlImGuiImageSize(const Texture* image, int width, int height)
+{
+    if (!image)
+        return;
+    
+    SetFrameContext();
+    
+    ImGui::Image(ImTextureID(image->id), ImVec2(float(width), float(height)));
+}
+
+void rlImGuiImageSizeV(const Texture* image, Vector2 size)
+{
+    if (!image)
+        return;
+    
+    SetFrameContext();
+    
+    ImGui::Image(ImTextureID(image->id), ImVec2(size.x, size.y));
+}
+
+void rlImGuiImageRect(const Texture* image, int destWidth, int destHeight, Rectangle sourceRect)
+{
+    if (!image)
+        return;
+    
+    SetFrameContext();
+    
+    ImVec2 uv0;
+    ImVec2 uv1;
+
+    if (sourceRect.width < 0)
+    {
+        uv0.x = -sourceRect.x / image->width;
+        uv1.x = (uv0.x - float(fabs(sourceRect.width) / image->width));
+    }
+    else
+    {
+        uv0.x = sourceRect.x / image->width;
+        uv1.x = uv0.x + float(sourceRect.width / image->width);
+    }
+
+    if (sourceRect.height < 0)
+    {
+        uv0.y = -sourceRect.y / image->height;
+        uv1.y = (uv0.y - fabsf(sourceRect.height) / image->height);
+    }
+    else
+    {
+        uv0.y = sourceRect.y / image->height;
+        uv1.y = uv0.y + sourceRect.height / image->height;
+    }
+
+    ImGui::Image((ImTextureID)image->id, ImVec2(float(destWidth), float(destHeight)), uv0, uv1);
+}
+
+static bool GetRenderTextureContent(const RenderTexture* texture, int& width, int& height);
+
+// render textures are upside down, textures from the pool only show the part that was drawn
+static void ImageRenderTextureContent(const RenderTexture* image, int width, int height, ImVec2 size)
+{
+    ImVec2 uv0(0, height / float(image->texture.height));
+    ImVec2 uv1(width / float(image->texture.width), 0);
+    ImGui::Image(ImTextureID(image->texture.id), size, uv0, uv1);
+}
+
+void rlImGuiImageRenderTexture(const RenderTexture* image)
+{
+    if (!image)
+        return;
+    
+    SetFrameContext();
+
+    int width = image->texture.width;
+    int height = image->texture.height;
+    if (GetRenderTextureContent(image, width, height))
+    {
+        ImageRenderTextureContent(image, width, height, ImVec2(float(width), float(height)));
+        return;
+    }
+    
+    rlImGuiImageRect(&image->texture, image->texture.width, image->texture.height, Rectangle{ 0,0, float(image->texture.width), -float(image->texture.height) });
+}
+
+void rlImGuiImageRenderTextureFit(const RenderTexture* image, bool center)
+{
+    if (!image)
+        return;
+    
+    SetFrameContext();
+
+    int width = image->texture.width;
+    int height = image->texture.height;
+    bool pooled = GetRenderTextureContent(image, width, height);
+
+    ImVec2 area = ImGui::GetContentRegionAvail();
+
+    float scale =  area.x / width;
+
+    float y = height * scale;
+    if (y > area.y)
+    {
+        scale = area.y / height;
+    }
+
+    int sizeX = int(width * scale);
+    int sizeY = int(height * scale);
+
+    if (center)
+    {
+        ImGui::SetCursorPosX(0);
+        ImGui::SetCursorPosX(area.x/2 - sizeX/2);
+        ImGui::SetCursorPosY(ImGui::GetCursorPosY() + (area.y / 2 - sizeY / 2));
+    }
+
+    if (pooled)
+    {
+        ImageRenderTextureContent(image, width, height, ImVec2(float(sizeX), float(sizeY)));
+        return;
+    }
+
+    rlImGuiImageRect(&image->texture, sizeX, sizeY, Rectangle{ 0,0, float(image->texture.width), -float(image->texture.height) });
+}
+
+// image options
+static bool SameImageOptions(const rlImGuiImageOptions& a, const rlImGuiImageOptions& b)
+{
+    return a.Filter == b.Filter && a.Wrap == b.Wrap && a.DrawShader.id == b.DrawShader.id;
+}
+
+// the renderer starts every draw list with the default options, so what a draw list draws with
+// only depends on the options pushed into that draw list
+static rlImGuiImageOptions DrawListImageOptions(const ImDrawList* drawList)
+{
+    for (int i = ImageOptionsStack.Size - 1; i >= 0; i--)
+    {
+        if (ImageOptionsStack[i].DrawList == drawList)
+            return ImageOptionsStack[i].Options;
+    }
+    return rlImGuiDefaultImageOptions();
+}
+
+static void AddImageOptionsCommand(ImDrawList* drawList, const rlImGuiImageOptions& options)
+{
+    // ImGui keeps a copy of the options in the draw list
+    rlImGuiImageOptions data = options;
+    drawList->AddCallback(ImageOptionsCallback, &data, sizeof(data));
+}
+
+rlImGuiImageOptions rlImGuiDefaultImageOptions(void)
+{
+    rlImGuiImageOptions options = { 0 };
+    options.Filter = -1;
+    options.Wrap = -1;
+    return options;
+}
+
+void rlImGuiPushImageOptions(const rlImGuiImageOptions* options)
+{
+    SetFrameContext();
+
+    ImageOptionsEntry entry;
+    entry.Options = options ? *options : rlImGuiDefaultImageOptions();
+    entry.DrawList = ImGui::GetWindowDrawList();
+
+    if (!SameImageOptions(entry.Options, DrawListImageOptions(entry.DrawList)))
+        AddImageOptionsCommand(entry.DrawList, entry.Options);
+
+    ImageOptionsStack.push_back(entry);
+}
+
+void rlImGuiPopImageOptions(void)
+{
+    if (ImageOptionsStack.empty())
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: rlImGuiPopImageOptions called without a matching rlImGuiPushImageOptions");
+        return;
+    }
+
+    SetFrameContext();
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    rlImGuiImageOptions before = DrawListImageOptions(drawList);
+    ImageOptionsStack.pop_back();
+
+    rlImGuiImageOptions after = DrawListImageOptions(drawList);
+    if (!SameImageOptions(before, after))
+        AddImageOptionsCommand(drawList, after);
+}
+
+void rlImGuiImageEx(const Texture* image, Vector2 size, const rlImGuiImageOptions* options)
+{
+    if (!image)
+        return;
+
+    if (size.x <= 0 || size.y <= 0)
+        size = Vector2{ float(image->width), float(image->height) };
+
+    rlImGuiPushImageOptions(options);
+    ImGui::Image(ImTextureID(image->id), ImVec2(size.x, size.y));
+    rlImGuiPopImageOptions();
+}
+
+bool rlImGuiImageButtonEx(const char* name, const Texture* image, Vector2 size, const rlImGuiImageOptions* options)
+{
+    if (!image)
+        return false;
+
+    if (size.x <= 0 || size.y <= 0)
+        size = Vector2{ float(image->width), float(image->height) };
+
+    rlImGuiPushImageOptions(options);
+    bool clicked = ImGui::ImageButton(name, ImTextureID(image->id), ImVec2(size.x, size.y));
+    rlImGuiPopImageOptions();
+    return clicked;
+}
+
+void rlImGuiSetTextureSampler(const Texture* texture, int filter, int wrap)
+{
+    if (!texture || texture->id == 0)
+        return;
+
+    SetTextureFilter(*texture, filter);
+    SetTextureWrap(*texture, wrap);
+    TextureSamplers.SetInt(texture->id, PackSampler(filter, wrap, texture->mipmaps > 1));
+}
+
+bool rlImGuiGetImageOptionsStats(rlImGuiImageOptionsStats* stats)
+{
+    if (!stats)
+        return false;
+
+    *stats = RenderStateStats;
+    return true;
+}
+
+// image batches
+// Images are written straight into the window draw list, one texture change per run of images from the same texture,
+// and images outside the clip rect are skipped before any vertices are made.
+struct ImageBatchWriter
+{
+    ImDrawList* DrawList = nullptr;
+    ImVec2 ClipMin;
+    ImVec2 ClipMax;
+    unsigned int TextureId = 0;
+
+    void Begin(ImDrawList* drawList)
+    {
+        DrawList = drawList;
+        ClipMin = drawList->GetClipRectMin();
+        ClipMax = drawList->GetClipRectMax();
+        TextureId = 0;
+    }
+
+    void End()
+    {
+        if (TextureId != 0)
+            DrawList->PopTexture();
+        TextureId = 0;
+    }
+
+    // the same source rect rules as DrawTexturePro, a negative width or height flips the image
+    void Add(const Texture* image, Rectangle source, ImVec2 min, ImVec2 max, Color tint)
+    {
+        if (!image || image->id == 0 || image->width == 0 || image->height == 0)
+            return;
+
+        if (max.x < ClipMin.x || max.y < ClipMin.y || min.x > ClipMax.x || min.y > ClipMax.y)
+            return;
+
+        if (image->id != TextureId)
+        {
+            if (TextureId != 0)
+                DrawList->PopTexture();
+            DrawList->PushTexture(ImTextureID(image->id));
+            TextureId = image->id;
+        }
+
+        ImVec2 uv0(source.x / image->width, source.y / image->height);
+        ImVec2 uv1((source.x + fabsf(source.width)) / image->width, (source.y + fabsf(source.height)) / image->height);
+        if (source.width < 0)
+            ImSwap(uv0.x, uv1.x);
+        if (source.height < 0)
+            ImSwap(uv0.y, uv1.y);
+
+        DrawList->PrimReserve(6, 4);
+        DrawList->PrimRectUV(min, max, uv0, uv1, IM_COL32(tint.r, tint.g, tint.b, tint.a));
+    }
+};
+
+// fits a source rect in a cell, keeping its aspect and centering it
+static void FitImageInCell(Rectangle source, ImVec2 cellMin, ImVec2 cellSize, ImVec2& min, ImVec2& max)
+{
+    float width = fabsf(source.width);
+    float height = fabsf(source.height);
+    float scale = (width > 0 && height > 0) ? ImMin(cellSize.x / width, cellSize.y / height) : 0.0f;
+
+    ImVec2 size(width * scale, height * scale);
+    min = ImVec2(cellMin.x + (cellSize.x - size.x) * 0.5f, cellMin.y + (cellSize.y - size.y) * 0.5f);
+    max = ImVec2(min.x + size.x, min.y + size.y);
+}
+
+static int GetImageGridColumns(Vector2 cellSize, int columns)
+{
+    if (columns > 0)
+        return columns;
+
+    float pitch = cellSize.x + ImGui::GetStyle().ItemSpacing.x;
+    return ImMax(1, int((ImGui::GetContentRegionAvail().x + ImGui::GetStyle().ItemSpacing.x) / pitch));
+}
+
+void rlImGuiImageBatch(const rlImGuiImageBatchEntry* entries, int count)
+{
+    if (!entries || count <= 0)
+        return;
+
+    SetFrameContext();
+
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+
+    ImVec2 extent(0, 0);
+    for (int i = 0; i < count; i++)
+    {
+        extent.x = ImMax(extent.x, entries[i].Dest.x + entries[i].Dest.width);
+        extent.y = ImMax(extent.y, entries[i].Dest.y + entries[i].Dest.height);
+    }
+
+    // the batch is one item, if it is clipped nothing is written
+    ImGui::Dummy(extent);
+    if (!ImGui::IsItemVisible())
+        return;
+
+    ImageBatchWriter writer;
+    writer.Begin(ImGui::GetWindowDrawList());
+    for (int i = 0; i < count; i++)
+    {
+        const rlImGuiImageBatchEntry& entry = entries[i];
+        ImVec2 min(origin.x + entry.Dest.x, origin.y + entry.Dest.y);
+        ImVec2 max(min.x + entry.Dest.width, min.y + entry.Dest.height);
+        writer.Add(entry.Image, entry.Source, min, max, entry.Tint);
+    }
+    writer.End();
+}
+
+int rlImGuiLayoutImageGrid(rlImGuiImageBatchEntry* entries, int count, Vector2 cellSize, int columns)
+{
+    if (!entries || count <= 0)
+        return 0;
+
+    SetFrameContext();
+
+    columns = GetImageGridColumns(cellSize, columns);
+    ImVec2 spacing = ImGui::GetStyle().ItemSpacing;
+
+    for (int i = 0; i < count; i++)
+    {
+        ImVec2 cellMin((i % columns) * (cellSize.x + spacing.x), (i / columns) * (cellSize.y + spacing.y));
+        ImVec2 min, max;
+        FitImageInCell(entries[i].Source, cellMin, ImVec2(cellSize.x, cellSize.y), min, max);
+        entries[i].Dest = Rectangle{ min.x, min.y, max.x - min.x, max.y - min.y };
+    }
+    return columns;
+}
+
+int rlImGuiImageGrid(const char* name, const rlImGuiImageBatchEntry* entries, int count, Vector2 cellSize, int columns, int* hoveredIndex)
+{
+    if (hoveredIndex)
+        *hoveredIndex = -1;
+
+    if (!name || !entries || count <= 0)
+        return -1;
+
+    SetFrameContext();
+
+    columns = GetImageGridColumns(cellSize, columns);
+    ImVec2 spacing = ImGui::GetStyle().ItemSpacing;
+    ImVec2 pitch(cellSize.x + spacing.x, cellSize.y + spacing.y);
+    int rows = (count + columns - 1) / columns;
+
+    ImGui::PushID(name);
+
+    int clicked = -1;
+    ImageBatchWriter writer;
+    writer.Begin(ImGui::GetWindowDrawList());
+
+    // only the rows that can be seen are laid out and drawn
+    ImGuiListClipper clipper;
+    clipper.Begin(rows, pitch.y);
+    while (clipper.Step())
+    {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+        {
+            ImVec2 rowPos = ImGui::GetCursorScreenPos();
+            int first = row * columns;
+            int last = ImMin(first + columns, count);
+
+            for (int i = first; i < last; i++)
+            {
+                ImVec2 cellMin(rowPos.x + (i - first) * pitch.x, rowPos.y);
+                ImVec2 min, max;
+                FitImageInCell(entries[i].Source, cellMin, ImVec2(cellSize.x, cellSize.y), min, max);
+                writer.Add(entries[i].Image, entries[i].Source, min, max, entries[i].Tint);
+            }
+
+            // a row is one item, the cell under the mouse is worked out from the position
+            ImGui::Dummy(ImVec2(columns * pitch.x - spacing.x, cellSize.y));
+            if (ImGui::IsItemHovered())
+            {
+                int column = int((ImGui::GetMousePos().x - rowPos.x) / pitch.x);
+                int index = first + column;
+                if (column >= 0 && column < columns && index < last)
+                {
+                    if (hoveredIndex)
+                        *hoveredIndex = index;
+                    if (ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+                        clicked = index;
+                }
+            }
+        }
+    }
+    clipper.End();
+    writer.End();
+
+    ImGui::PopID();
+    return clicked;
+}
+
+// sprite sheets
+// The UVs of every frame are worked out once, with a copy for each flip, so drawing a frame is a table lookup
+struct SpriteFrameUV
+{
+    ImVec2 Uv0;
+    ImVec2 Uv1;
+};
+
+struct rlImGuiSpriteSheet
+{
+    Texture Image = { 0 };
+    ImVector<ImVec2> FrameSizes;
+    ImVector<SpriteFrameUV> UVs;    // 4 per frame, not flipped, flipped on X, flipped on Y, flipped on both
+};
+
+static rlImGuiSpriteSheet* CreateSpriteSheet(const Texture* texture, const Rectangle* frames, int frameCount)
+{
+    rlImGuiSpriteSheet* sheet = IM_NEW(rlImGuiSpriteSheet)();
+    sheet->Image = *texture;
+    sheet->FrameSizes.resize(frameCount);
+    sheet->UVs.resize(frameCount * 4);
+
+    const float width = float(texture->width);
+    const float height = float(texture->height);
+    for (int i = 0; i < frameCount; i++)
+    {
+        const Rectangle& frame = frames[i];
+        sheet->FrameSizes[i] = ImVec2(frame.width, frame.height);
+
+        ImVec2 uv0(frame.x / width, frame.y / height);
+        ImVec2 uv1((frame.x + frame.width) / width, (frame.y + frame.height) / height);
+
+        SpriteFrameUV* uvs = &sheet->UVs[i * 4];
+        uvs[0] = SpriteFrameUV{ uv0, uv1 };
+        uvs[1] = SpriteFrameUV{ ImVec2(uv1.x, uv0.y), ImVec2(uv0.x, uv1.y) };
+        uvs[2] = SpriteFrameUV{ ImVec2(uv0.x, uv1.y), ImVec2(uv1.x, uv0.y) };
+        uvs[3] = SpriteFrameUV{ uv1, uv0 };
+    }
+    return sheet;
+}
+
+static const SpriteFrameUV* GetSpriteFrameUV(const rlImGuiSpriteSheet* sheet, int frame, bool flipX, bool flipY)
+{
+    if (!sheet || frame < 0 || frame >= sheet->FrameSizes.Size)
+        return nullptr;
+
+    return &sheet->UVs[frame * 4 + (flipX ? 1 : 0) + (flipY ? 2 : 0)];
+}
+
+static ImVec2 GetSpriteDrawSize(const rlImGuiSpriteSheet* sheet, int frame, Vector2 size)
+{
+    // a size of 0 draws the frame at the size it is in the texture
+    if (size.x <= 0 || size.y <= 0)
+        return sheet->FrameSizes[frame];
+    return ImVec2(size.x, size.y);
+}
+
+rlImGuiSpriteSheet* rlImGuiCreateSpriteSheetGrid(const Texture* texture, int frameWidth, int frameHeight, int frameCount)
+{
+    if (!texture || texture->id == 0 || frameWidth <= 0 || frameHeight <= 0)
+        return nullptr;
+
+    int columns = texture->width / frameWidth;
+    int rows = texture->height / frameHeight;
+    if (frameCount <= 0 || frameCount > columns * rows)
+        frameCount = columns * rows;
+    if (frameCount <= 0)
+        return nullptr;
+
+    // frames are read left to right, then top to bottom
+    ImVector<Rectangle> frames;
+    frames.resize(frameCount);
+    for (int i = 0; i < frameCount; i++)
+        frames[i] = Rectangle{ float((i % columns) * frameWidth), float((i / columns) * frameHeight), float(frameWidth), float(frameHeight) };
+
+    return CreateSpriteSheet(texture, frames.Data, frameCount);
+}
+
+rlImGuiSpriteSheet* rlImGuiCreateSpriteSheetFrames(const Texture* texture, const Rectangle* frames, int frameCount)
+{
+    if (!texture || texture->id == 0 || !frames || frameCount <= 0)
+        return nullptr;
+
+    return CreateSpriteSheet(texture, frames, frameCount);
+}
+
+void rlImGuiDestroySpriteSheet(rlImGuiSpriteSheet* sheet)
+{
+    if (sheet)
+        IM_DELETE(sheet);
+}
+
+int rlImGuiGetSpriteSheetFrameCount(const rlImGuiSpriteSheet* sheet)
+{
+    return sheet ? sheet->FrameSizes.Size : 0;
+}
+
+Vector2 rlImGuiGetSpriteFrameSize(const rlImGuiSpriteSheet* sheet, int frame)
+{
+    if (!sheet || frame < 0 || frame >= sheet->FrameSizes.Size)
+        return Vector2{ 0, 0 };
+
+    return Vector2{ sheet->FrameSizes[frame].x, sheet->FrameSizes[frame].y };
+}
+
+void rlImGuiSprite(const rlImGuiSpriteSheet* sheet, int frame, Vector2 size)
+{
+    const SpriteFrameUV* uv = GetSpriteFrameUV(sheet, frame, false, false);
+    if (!uv)
+        return;
+
+    SetFrameContext();
+    ImGui::Image(ImTextureID(sheet->Image.id), GetSpriteDrawSize(sheet, frame, size), uv->Uv0, uv->Uv1);
+}
+
+void rlImGuiSpriteEx(const rlImGuiSpriteSheet* sheet, int frame, Vector2 size, bool flipX, bool flipY, Color tint)
+{
+    const SpriteFrameUV* uv = GetSpriteFrameUV(sheet, frame, flipX, flipY);
+    if (!uv)
+        return;
+
+    SetFrameContext();
+    ImVec4 tintColor(tint.r / 255.0f, tint.g / 255.0f, tint.b / 255.0f, tint.a / 255.0f);
+    ImGui::ImageWithBg(ImTextureID(sheet->Image.id), GetSpriteDrawSize(sheet, frame, size), uv->Uv0, uv->Uv1, ImVec4(0, 0, 0, 0), tintColor);
+}
+
+bool rlImGuiSpriteButton(const char* name, const rlImGuiSpriteSheet* sheet, int frame, Vector2 size)
+{
+    const SpriteFrameUV* uv = GetSpriteFrameUV(sheet, frame, false, false);
+    if (!uv)
+        return false;
+
+    SetFrameContext();
+    return ImGui::ImageButton(name, ImTextureID(sheet->Image.id), GetSpriteDrawSize(sheet, frame, size), uv->Uv0, uv->Uv1);
+}
+
+int rlImGuiGetSpriteAnimationFrame(int firstFrame, int frameCount, float framesPerSecond, double time, bool loop)
+{
+    if (frameCount <= 1 || framesPerSecond <= 0 || time <= 0)
+        return firstFrame;
+
+    long long step = (long long)(time * framesPerSecond);
+    if (loop)
+        return firstFrame + int(step % frameCount);
+
+    return firstFrame + int(ImMin(step, (long long)frameCount - 1));
+}
+
+void rlImGuiSpriteAnimated(const rlImGuiSpriteSheet* sheet, int firstFrame, int frameCount, float framesPerSecond, Vector2 size)
+{
+    if (!sheet)
+        return;
+
+    // ImGui time is used so every preview of the same animation shows the same frame
+    SetFrameContext();
+    rlImGuiSprite(sheet, rlImGuiGetSpriteAnimationFrame(firstFrame, frameCount, framesPerSecond, ImGui::GetTime(), true), size);
+}
+
+// raw ImGui backend API
+ImGuiKey ImGui_ImplRaylib_KeyToImGuiKey(int key)
+{
+    if (key <= KEY_NULL || key >= MAX_RAYLIB_KEY)
+        return ImGuiKey_None;
+
+    return KeyTable.ToImGui[key];
+}
+
+int ImGui_ImplRaylib_ImGuiKeyToKey(ImGuiKey key)
+{
+    if (key < ImGuiKey_NamedKey_BEGIN || key >= ImGuiKey_NamedKey_END)
+        return KEY_NULL;
+
+    return KeyTable.ToRaylib[key - ImGuiKey_NamedKey_BEGIN];
+}
+
+bool ImGui_ImplRaylib_Init(void)
+{
+    SetupMouseCursors();
+
+    SetupBackend();
+
+    return true;
+}
+
+
+void ImGui_ImplRaylib_Shutdown()
+{
+    for (auto& texture : ImGui::GetPlatformIO().Textures)
+    {
+        // textures from a shared atlas are kept until the last context using them shuts down
+        if (texture->RefCount > 1)
+            continue;
+
+        if (texture->Status != ImTextureStatus_Destroyed)
+        {
+            Texture* backendData = (Texture*)texture->BackendUserData;
+            if (backendData && IsTextureValid(*backendData))
+            {
+                TextureStats.TextureCount--;
+                TextureStats.TextureDestroys++;
+                TextureStats.TextureBytes -= (long long)texture->Width * texture->Height * texture->BytesPerPixel;
+                UnloadTexture(*backendData);
+            }
+            if (backendData)
+                MemFree(backendData);
+
+            texture->BackendUserData = nullptr;
+            texture->Status = ImTextureStatus_Destroyed;
+            texture->SetTexID(ImTextureID_Invalid);
+        }
+    }
+
+    ImGui_ImplRaylib_FreeBackendData();
+
+#if defined(RLIMGUI_GLFW_EVENTS)
+    // the callbacks are installed for the window, not a context
+    if (GlobalContext == nullptr || ImGui::GetCurrentContext() == GlobalContext)
+        RemoveGlfwCallbacks();
+#endif
+}
+
+void ImGui_ImplRaylib_NewFrame(void)
+{
+    ImGuiNewFrame(GetFrameTime());
+}
+
+void ImGui_ImplRaylib_UpdateTexture(ImTextureData* tex)
+{
+    switch (tex->Status)
+    {
         case ImTextureStatus_OK:
         case ImTextureStatus_Destroyed:
         default:
             break;
 
-        case ImTextureStatus_WantCreate:
+        case ImTextureStatus_WantCreate:
+        {
+            Image img = { 0 };
+            img.width = tex->Width;
+            img.height = tex->Height;
+
+            img.format = tex->Format == ImTextureFormat_Alpha8 ? PIXELFORMAT_UNCOMPRESSED_GRAYSCALE : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            img.mipmaps = 1;
+            img.data = tex->GetPixels();
+
+            Texture* texture = (Texture*)MemAlloc(sizeof(Texture));
+            tex->BackendUserData = texture;;
+            *texture = LoadTextureFromImage(img);
+            tex->SetTexID(ImTextureID(texture->id));
+
+            // distance field glyphs are scaled, so they need filtering
+            if (SdfFontsEnabled)
+                SetTextureFilter(*texture, TEXTURE_FILTER_BILINEAR);
+            tex->Status = ImTextureStatus_OK;
+
+            TextureStats.TextureCount++;
+            TextureStats.TextureCreates++;
+            TextureStats.TextureBytes += (long long)tex->Width * tex->Height * tex->BytesPerPixel;
+        }
+            break;
+
+        case ImTextureStatus_WantUpdates:
+        {
+            Texture* texture = (Texture*)tex->BackendUserData;
+            if (!texture)
+                break;
+
+            // the atlas texture is shared, so the first context to draw uploads new glyphs for all of them.
+            // only the changed rects are uploaded, raylib wants the pixels of each rect packed together
+            if (tex->Updates.empty())
+            {
+                UpdateTexture(*texture, tex->GetPixels());
+                TextureStats.TextureUploadBytes += (long long)tex->GetSizeInBytes();
+            }
+
+            for (const ImTextureRect& rect : tex->Updates)
+            {
+                int rowBytes = rect.w * tex->BytesPerPixel;
+                TextureUploadBuffer.resize(rowBytes * rect.h);
+                for (int y = 0; y < rect.h; y++)
+                    memcpy(TextureUploadBuffer.Data + y * rowBytes, tex->GetPixelsAt(rect.x, rect.y + y), rowBytes);
+
+                UpdateTextureRec(*texture, Rectangle{ float(rect.x), float(rect.y), float(rect.w), float(rect.h) }, TextureUploadBuffer.Data);
+                TextureStats.TextureUploadBytes += rowBytes * rect.h;
+            }
+            TextureStats.TextureUpdates++;
+
+            tex->Status = ImTextureStatus_OK;
+        }
+            break;
+
+        case ImTextureStatus_WantDestroy:
+        {
+            Texture* texture = (Texture*)tex->BackendUserData;
+
+            if (!texture)
+                break;
+            UnloadTexture(*texture);
+            TextureStats.TextureCount--;
+            TextureStats.TextureDestroys++;
+            TextureStats.TextureBytes -= (long long)tex->Width * tex->Height * tex->BytesPerPixel;
+            tex->Status = ImTextureStatus_Destroyed;
+            MemFree(texture);
+            tex->BackendUserData = nullptr;
+            tex->SetTexID(ImTextureID_Invalid);
+        }
+        break;
+    }
+}
+
+static void DrawCursorQuad(unsigned int textureId, ImVec2 min, ImVec2 max, ImVec2 uvMin, ImVec2 uvMax, Color color)
+{
+    rlBegin(RL_QUADS);
+    rlSetTexture(textureId);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+
+    rlTexCoord2f(uvMin.x, uvMin.y);
+    rlVertex2f(min.x, min.y);
+
+    rlTexCoord2f(uvMin.x, uvMax.y);
+    rlVertex2f(min.x, max.y);
+
+    rlTexCoord2f(uvMax.x, uvMax.y);
+    rlVertex2f(max.x, max.y);
+
+    rlTexCoord2f(uvMax.x, uvMin.y);
+    rlVertex2f(max.x, min.y);
+    rlEnd();
+}
+
+// draws ImGui's software cursor at the position the mouse has right now, instead of where it was when the frame started
+static void DrawLateSoftwareCursor(void)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiMouseCursor cursor = ImGui::GetMouseCursor();
+    if (cursor == ImGuiMouseCursor_None || io.MouseDrawCursor)
+        return;
+
+    ImVec2 mouse;
+    if (!GetLatestMousePos(mouse))
+        return;
+
+    ImVec2 offset, size, uv[4];
+    if (!ImFontAtlasGetMouseCursorTexData(io.Fonts, cursor, &offset, &size, &uv[0], &uv[2]))
+        return;
+
+    float scale = ImGui::GetStyle().MouseCursorScale;
+    ImVec2 pos = ImVec2(mouse.x - offset.x * scale, mouse.y - offset.y * scale);
+    ImVec2 end = ImVec2(pos.x + size.x * scale, pos.y + size.y * scale);
+    unsigned int textureId = static_cast<unsigned int>(io.Fonts->TexRef.GetTexID());
+
+    // same layers as ImGui::RenderMouseCursor
+    DrawCursorQuad(textureId, ImVec2(pos.x + 1 * scale, pos.y), ImVec2(end.x + 1 * scale, end.y), uv[2], uv[3], Color{ 0, 0, 0, 48 });
+    DrawCursorQuad(textureId, ImVec2(pos.x + 2 * scale, pos.y), ImVec2(end.x + 2 * scale, end.y), uv[2], uv[3], Color{ 0, 0, 0, 48 });
+    DrawCursorQuad(textureId, pos, end, uv[2], uv[3], BLACK);
+    DrawCursorQuad(textureId, pos, end, uv[0], uv[1], WHITE);
+    rlDrawRenderBatchActive();
+}
+
+void ImGui_ImplRaylib_RenderDrawData(ImDrawData* draw_data)
+{
+    double renderTime = GetTime();
+
+    if (draw_data->Textures != nullptr)
+    {
+        for (ImTextureData* tex : *draw_data->Textures)
+        {
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplRaylib_UpdateTexture(tex);
+        }
+    }
+
+    rlDrawRenderBatchActive();
+    rlDisableBackfaceCulling();
+
+    RenderStateStats = rlImGuiImageOptionsStats{ 0 };
+    RenderDisplayPos = draw_data->DisplayPos;
+    RenderDisplaySize = draw_data->DisplaySize;
+    SceneStats = rlImGuiSceneStats{ 0 };
+
+    for (int l = 0; l < draw_data->CmdListsCount; ++l)
+    {
+        const ImDrawList* commandList = draw_data->CmdLists[l];
+
+        // options are pushed per window, they never carry over from one draw list to the next
+        RenderImageOptions = rlImGuiDefaultImageOptions();
+
+        for (const auto& cmd : commandList->CmdBuffer)
+        {
+            if (cmd.UserCallback == ImageOptionsCallback)
+            {
+                // nothing changes until a draw needs it, so options that are set and set back again cost nothing
+                RenderImageOptions = *static_cast<const rlImGuiImageOptions*>(cmd.UserCallbackData);
+                RenderStateStats.OptionCommands++;
+                continue;
+            }
+
+            EnableScissor(cmd.ClipRect.x - draw_data->DisplayPos.x, cmd.ClipRect.y - draw_data->DisplayPos.y, cmd.ClipRect.z - (cmd.ClipRect.x - draw_data->DisplayPos.x), cmd.ClipRect.w - (cmd.ClipRect.y - draw_data->DisplayPos.y));
+            if (cmd.UserCallback == ImDrawCallback_ResetRenderState)
+            {
+                ResetImageRenderState();
+                continue;
+            }
+
+            if (cmd.UserCallback != nullptr)
+            {
+                // user callbacks start from the default shader and texture since we don't know what they will do with them
+                EndRenderShader();
+                rlSetTexture(0);
+                cmd.UserCallback(commandList, &cmd);
+            }
+            else
+            {
+                ApplyImageRenderState(cmd);
+                ImGuiRenderTriangles(cmd.ElemCount, cmd.IdxOffset, commandList->IdxBuffer, commandList->VtxBuffer, cmd.GetTexID());
+            }
+            rlDrawRenderBatchActive();
+        }
+    }
+
+    RestoreImageRenderState();
+
+    rlDisableScissorTest();
+
+    // drawn after the scissor is off so it is not clipped to the last command
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (platData && platData->LateSoftwareCursor && !platData->HasTarget)
+        DrawLateSoftwareCursor();
+
+    rlSetTexture(0);
+    rlEnableBackfaceCulling();
+
+    FinishInputLatencyFrame(renderTime);
+}
+
+static void RecordInputEvent(unsigned int type, int param0, int param1 = 0, int param2 = 0, int param3 = 0)
+{
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (!platData || !platData->Recording)
+        return;
+
+    AutomationEventList& list = platData->Recorded;
+    if (list.count == list.capacity)
+    {
+        list.capacity = list.capacity == 0 ? 1024 : list.capacity * 2;
+        list.events = (AutomationEvent*)MemRealloc(list.events, list.capacity * sizeof(AutomationEvent));
+    }
+
+    AutomationEvent& event = list.events[list.count++];
+    event.frame = platData->RecordFrame;
+    event.type = type;
+    event.params[0] = param0;
+    event.params[1] = param1;
+    event.params[2] = param2;
+    event.params[3] = param3;
+}
+
+// everything the backend feeds to ImGui goes through these, so that it can be recorded
+static void SubmitFocusEvent(ImGuiIO& io, bool focused)
+{
+    io.AddFocusEvent(focused);
+    RecordInputEvent(InputEvent_Focus, focused);
+    TrackInputLatency(ImGui_ImplRaylib_GetBackendData());
+}
+
+static void SubmitKeyEvent(ImGuiIO& io, ImGuiKey key, bool down)
+{
+    io.AddKeyEvent(key, down);
+    RecordInputEvent(InputEvent_Key, key, down);
+    TrackInputLatency(ImGui_ImplRaylib_GetBackendData());
+}
+
+static void SubmitKeyAnalogEvent(ImGuiIO& io, ImGuiKey key, bool down, float value)
+{
+    io.AddKeyAnalogEvent(key, down, value);
+
+    // the gamepad sticks are sent every frame, only record the changes
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (!platData || !platData->Recording || key < ImGuiKey_NamedKey_BEGIN || key >= ImGuiKey_NamedKey_END)
+        return;
+
+    float& lastValue = platData->LastAnalogValue[key - ImGuiKey_NamedKey_BEGIN];
+    if (lastValue == value)
+        return;
+
+    lastValue = value;
+    RecordInputEvent(InputEvent_KeyAnalog, key, down, FloatToParam(value));
+}
+
+static void SubmitCharEvent(ImGuiIO& io, unsigned int codepoint)
+{
+    io.AddInputCharacter(codepoint);
+    RecordInputEvent(InputEvent_Char, int(codepoint));
+    TrackInputLatency(ImGui_ImplRaylib_GetBackendData());
+}
+
+static void SubmitMousePosEvent(ImGuiIO& io, float x, float y)
+{
+    io.AddMousePosEvent(x, y);
+
+    // the mouse position is sent every frame, only record the changes
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (platData && (platData->LatencyLastMousePos.x != x || platData->LatencyLastMousePos.y != y))
+    {
+        platData->LatencyLastMousePos = ImVec2(x, y);
+        TrackInputLatency(platData);
+    }
+
+    if (!platData || !platData->Recording || (platData->LastRecordedMousePos.x == x && platData->LastRecordedMousePos.y == y))
+        return;
+
+    platData->LastRecordedMousePos = ImVec2(x, y);
+    RecordInputEvent(InputEvent_MousePos, FloatToParam(x), FloatToParam(y));
+}
+
+static void SubmitMouseButtonEvent(ImGuiIO& io, int button, bool down)
+{
+    io.AddMouseButtonEvent(button, down);
+    RecordInputEvent(InputEvent_MouseButton, button, down);
+    TrackInputLatency(ImGui_ImplRaylib_GetBackendData());
+}
+
+static void SubmitMouseWheelEvent(ImGuiIO& io, float x, float y)
+{
+    if (x == 0 && y == 0)
+        return;
+
+    io.AddMouseWheelEvent(x, y);
+    RecordInputEvent(InputEvent_MouseWheel, FloatToParam(x), FloatToParam(y));
+    TrackInputLatency(ImGui_ImplRaylib_GetBackendData());
+}
+
+// the frame timing and display size are not events in ImGui, but replay needs them to lay out the same frames
+static void RecordFrameState(ImGuiIO& io, ImGui_ImplRaylib_Data* platData)
+{
+    RecordInputEvent(InputEvent_DeltaTime, FloatToParam(io.DeltaTime));
+
+    if (platData->LastRecordedDisplaySize.x != io.DisplaySize.x || platData->LastRecordedDisplaySize.y != io.DisplaySize.y
+        || platData->LastRecordedFramebufferScale.x != io.DisplayFramebufferScale.x || platData->LastRecordedFramebufferScale.y != io.DisplayFramebufferScale.y)
+    {
+        platData->LastRecordedDisplaySize = io.DisplaySize;
+        platData->LastRecordedFramebufferScale = io.DisplayFramebufferScale;
+        RecordInputEvent(InputEvent_DisplaySize, FloatToParam(io.DisplaySize.x), FloatToParam(io.DisplaySize.y), FloatToParam(io.DisplayFramebufferScale.x), FloatToParam(io.DisplayFramebufferScale.y));
+    }
+}
+
+static void SubmitInputEvent(ImGuiIO& io, const AutomationEvent& event)
+{
+    switch (event.type)
+    {
+    case InputEvent_DeltaTime:
+        io.DeltaTime = ParamToFloat(event.params[0]);
+        break;
+
+    case InputEvent_Focus:
+        SubmitFocusEvent(io, event.params[0] != 0);
+        break;
+
+    case InputEvent_Key:
+        SubmitKeyEvent(io, ImGuiKey(event.params[0]), event.params[1] != 0);
+        break;
+
+    case InputEvent_KeyAnalog:
+        SubmitKeyAnalogEvent(io, ImGuiKey(event.params[0]), event.params[1] != 0, ParamToFloat(event.params[2]));
+        break;
+
+    case InputEvent_Char:
+        SubmitCharEvent(io, (unsigned int)event.params[0]);
+        break;
+
+    case InputEvent_MousePos:
+        SubmitMousePosEvent(io, ParamToFloat(event.params[0]), ParamToFloat(event.params[1]));
+        break;
+
+    case InputEvent_MouseButton:
+        SubmitMouseButtonEvent(io, event.params[0], event.params[1] != 0);
+        break;
+
+    case InputEvent_MouseWheel:
+        SubmitMouseWheelEvent(io, ParamToFloat(event.params[0]), ParamToFloat(event.params[1]));
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void ReplayInputFrame(ImGuiIO& io, ImGui_ImplRaylib_Data* platData)
+{
+    const AutomationEventList& list = platData->Replay;
+    while (platData->ReplayCursor < list.count && list.events[platData->ReplayCursor].frame <= platData->ReplayFrame)
+    {
+        const AutomationEvent& event = list.events[platData->ReplayCursor];
+        if (event.type == InputEvent_DisplaySize)
+        {
+            platData->ReplayDisplaySize = ImVec2(ParamToFloat(event.params[0]), ParamToFloat(event.params[1]));
+            platData->ReplayFramebufferScale = ImVec2(ParamToFloat(event.params[2]), ParamToFloat(event.params[3]));
+        }
+        else
+        {
+            SubmitInputEvent(io, event);
+        }
+        platData->ReplayCursor++;
+    }
+
+    // the size is only recorded when it changes, but the new frame sets it from the window every frame
+    if (platData->ReplayDisplaySize.x >= 0)
+    {
+        io.DisplaySize = platData->ReplayDisplaySize;
+        io.DisplayFramebufferScale = platData->ReplayFramebufferScale;
+    }
+
+    platData->ReplayFrame++;
+
+    if (platData->ReplayFrame >= platData->ReplayFrameCount)
+    {
+        MemFree(platData->Replay.events);
+        platData->Replay = AutomationEventList{ 0 };
+        platData->Replaying = false;
+    }
+}
+
+void HandleGamepadButtonEvent(ImGuiIO& io, GamepadButton button, ImGuiKey key)
+{
+    if (IsGamepadButtonPressed(0, button))
+        SubmitKeyEvent(io, key, true);
+    else if (IsGamepadButtonReleased(0, button))
+        SubmitKeyEvent(io, key, false);
+}
+
+void HandleGamepadStickEvent(ImGuiIO& io, GamepadAxis axis, ImGuiKey negKey, ImGuiKey posKey)
+{
+    constexpr float deadZone = 0.20f;
+
+    float axisValue = GetGamepadAxisMovement(0, axis);
+
+    SubmitKeyAnalogEvent(io, negKey, axisValue < -deadZone, axisValue < -deadZone ? -axisValue : 0);
+    SubmitKeyAnalogEvent(io, posKey, axisValue > deadZone, axisValue > deadZone ? axisValue : 0);
+}
+
+// contexts that draw to a render texture can be given the screen rectangle the texture is shown in
+static ImVec2 MapMouseToContext(const ImGuiIO& io, const ImGui_ImplRaylib_Data* platData, float x, float y)
+{
+    const Rectangle& rect = platData->InputRect;
+    if (!platData->HasInputRect || rect.width <= 0 || rect.height <= 0)
+        return ImVec2(x, y);
+
+    return ImVec2((x - rect.x) * io.DisplaySize.x / rect.width, (y - rect.y) * io.DisplaySize.y / rect.height);
+}
+
+static void AddPolledInput(int type, int value, bool down, float x = 0, float y = 0)
+{
+    PolledInput input;
+    input.Type = type;
+    input.Value = value;
+    input.Down = down;
+    input.X = x;
+    input.Y = y;
+    PolledInputs.push_back(input);
+}
+
+// adds what changed in raylib since any context last polled it, contexts that poll in the same frame see no change
+static void CaptureRaylibInput(void)
+{
+    for (int i = 0; i < RaylibKeyPairCount; i++)
+    {
+        bool down = IsKeyDown(RaylibKeyPairs[i].RaylibKey);
+        if (down != PolledKeysDown[i])
+            AddPolledInput(PolledInput_Key, i, down);
+        PolledKeysDown[i] = down;
+    }
+
+    static constexpr int mouseButtons[][2] =
+    {
+        { MOUSE_BUTTON_LEFT, ImGuiMouseButton_Left },
+        { MOUSE_BUTTON_RIGHT, ImGuiMouseButton_Right },
+        { MOUSE_BUTTON_MIDDLE, ImGuiMouseButton_Middle },
+        { MOUSE_BUTTON_FORWARD, ImGuiMouseButton_Middle + 1 },
+        { MOUSE_BUTTON_BACK, ImGuiMouseButton_Middle + 2 },
+    };
+
+    for (const auto& button : mouseButtons)
+    {
+        unsigned int mask = 1u << button[1];
+        bool down = IsMouseButtonDown(button[0]);
+        if (down != ((PolledMouseButtonsDown & mask) != 0))
+            AddPolledInput(PolledInput_MouseButton, button[1], down, float(GetMouseX()), float(GetMouseY()));
+        PolledMouseButtonsDown = down ? (PolledMouseButtonsDown | mask) : (PolledMouseButtonsDown & ~mask);
+    }
+
+    unsigned int pressed = GetCharPressed();
+    while (pressed != 0)
+    {
+        AddPolledInput(PolledInput_Char, int(pressed), true);
+        pressed = GetCharPressed();
+    }
+
+    if (PolledInputs.Size > PolledInputLimit)
+    {
+        int dropped = PolledInputs.Size - PolledInputLimit;
+        PolledInputs.erase(PolledInputs.begin(), PolledInputs.begin() + dropped);
+        PolledInputStart += dropped;
+    }
+}
+
+// for contexts that get their input some other way, so they do not get old input once they poll raylib again
+static void SkipPolledInput(ImGui_ImplRaylib_Data* platData)
+{
+    platData->NextPolledInput = PolledInputStart + PolledInputs.Size;
+}
+
+static void PollRaylibKeyboard(ImGuiIO& io, ImGui_ImplRaylib_Data* platData)
+{
+    bool focused = IsWindowFocused();
+    if (focused != platData->LastFrameFocused)
+        SubmitFocusEvent(io, focused);
+    platData->LastFrameFocused = focused;
+
+    // handle the modifyer key events so that shortcuts work
+    bool ctrlDown = rlImGuiIsControlDown();
+    if (ctrlDown != platData->LastControlPressed)
+        SubmitKeyEvent(io, ImGuiMod_Ctrl, ctrlDown);
+    platData->LastControlPressed = ctrlDown;
+
+    bool shiftDown = rlImGuiIsShiftDown();
+    if (shiftDown != platData->LastShiftPressed)
+        SubmitKeyEvent(io, ImGuiMod_Shift, shiftDown);
+    platData->LastShiftPressed = shiftDown;
+
+    bool altDown = rlImGuiIsAltDown();
+    if (altDown != platData->LastAltPressed)
+        SubmitKeyEvent(io, ImGuiMod_Alt, altDown);
+    platData->LastAltPressed = altDown;
+
+    bool superDown = rlImGuiIsSuperDown();
+    if (superDown != platData->LastSuperPressed)
+        SubmitKeyEvent(io, ImGuiMod_Super, superDown);
+    platData->LastSuperPressed = superDown;
+}
+
+// sends everything that changed since this context last polled in order, so a click between two of its frames is still seen.
+// Contexts that get the mouse some other way, such as world panels, only take the keys and text
+static void SendPolledInput(ImGuiIO& io, ImGui_ImplRaylib_Data* platData, bool processsMouse, bool keyboardOnly)
+{
+    CaptureRaylibInput();
+
+    unsigned int endInput = PolledInputStart + PolledInputs.Size;
+    for (unsigned int i = ImMax(platData->NextPolledInput, PolledInputStart); i < endInput; i++)
+    {
+        const PolledInput& input = PolledInputs[int(i - PolledInputStart)];
+        switch (input.Type)
+        {
+        case PolledInput_Key:
+            SubmitKeyEvent(io, RaylibKeyPairs[input.Value].ImKey, input.Down);
+            break;
+
+        case PolledInput_MouseButton:
+            if (keyboardOnly)
+                break;
+
+            // releases are always sent so no button stays down
+            if (processsMouse && !io.WantSetMousePos)
+            {
+                ImVec2 mouse = MapMouseToContext(io, platData, input.X, input.Y);
+                SubmitMousePosEvent(io, mouse.x, mouse.y);
+            }
+            if (processsMouse || !input.Down)
+                SubmitMouseButtonEvent(io, input.Value, input.Down);
+            break;
+
+        case PolledInput_Char:
+            // add the text input in order
+            if (io.WantCaptureKeyboard)
+                SubmitCharEvent(io, (unsigned int)input.Value);
+            break;
+        }
+    }
+    platData->NextPolledInput = endInput;
+}
+
+static void PollRaylibInput(ImGuiIO& io, ImGui_ImplRaylib_Data* platData)
+{
+    PollRaylibKeyboard(io, platData);
+
+    bool processsMouse = platData->LastFrameFocused;
+
+#if defined(RLIMGUI_ALWAYS_TRACK_MOUSE)
+    processsMouse = true;
+#endif
+
+    SendPolledInput(io, platData, processsMouse, false);
+
+    if (processsMouse)
+    {
+        if (!io.WantSetMousePos)
+        {
+            ImVec2 mouse = ImVec2(float(GetMouseX()), float(GetMouseY()));
+            if (platData->LatchedMouseValid)
+            {
+                platData->LatencyCaptureTime = platData->LatchedMouseTime;
+                mouse = platData->LatchedMousePos;
+            }
+
+            mouse = MapMouseToContext(io, platData, mouse.x, mouse.y);
+            SubmitMousePosEvent(io, mouse.x, mouse.y);
+        }
+
+        {
+            Vector2 mouseWheel = GetMouseWheelMoveV();
+            SubmitMouseWheelEvent(io, mouseWheel.x, mouseWheel.y);
+        }
+    }
+    else
+    {
+        SubmitMousePosEvent(io, std::numeric_limits<float>::min(), std::numeric_limits<float>::min());
+    }
+}
+
+bool ImGui_ImplRaylib_ProcessEvents(void)
+{
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (!platData)
+    {
+        ImGui_ImplRaylib_CreateBackendData();
+        platData = ImGui_ImplRaylib_GetBackendData();
+        if (!platData)
+            return false;
+    }
+
+    // raylib polls the input right after the previous frame was drawn, so that is the closest known capture time for polled and replayed input
+    platData->LatencyCaptureTime = platData->LatencyLastDrawTime > 0 ? platData->LatencyLastDrawTime : GetTime();
+
+    if (platData->Replaying)
+    {
+        // the recorded frame replaces all live input
+        ReplayInputFrame(io, platData);
+        platData->LatchedMouseValid = false;
+        SkipPolledInput(platData);
+
+#if defined(RLIMGUI_GLFW_EVENTS)
+        QueuedInputEvent queued;
+        while (GlfwEventQueue.Pop(queued)) {}
+#endif
+        return true;
+    }
+
+    if (platData->Recording)
+        RecordFrameState(io, platData);
+
+    if (platData->ExternalInput)
+    {
+        // the input was already sent by whoever owns the context, such as a world panel, which also reads the polled input
+        platData->LatchedMouseValid = false;
+
+        if (platData->Recording)
+            platData->RecordFrame++;
+        return true;
+    }
+
+    if (!platData->InputEnabled)
+    {
+        // keep the mouse off the context so nothing stays hovered
+        SubmitMousePosEvent(io, -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+        platData->LatchedMouseValid = false;
+        SkipPolledInput(platData);
+
+        if (platData->Recording)
+            platData->RecordFrame++;
+        return true;
+    }
+
+#if defined(RLIMGUI_GLFW_EVENTS)
+    // the callbacks feed a single queue, so only the default context reads it, other contexts poll raylib
+    if (GlfwCallbackWindow && ImGui::GetCurrentContext() == GlobalContext)
+    {
+        // send the captured events in the order they happened, ImGui will trickle fast clicks over several frames if io.ConfigInputTrickleEventQueue is set
+        // positions are in raylib's mouse space already and get the same input rect mapping as polled input, chars only go in while ImGui wants the keyboard
+        QueuedInputEvent queued;
+        while (GlfwEventQueue.Pop(queued))
+        {
+            AutomationEvent& event = queued.Event;
+            if (event.type == InputEvent_Char && !io.WantCaptureKeyboard)
+                continue;
+
+            if (event.type == InputEvent_MousePos)
+            {
+                ImVec2 mouse = MapMouseToContext(io, platData, ParamToFloat(event.params[0]), ParamToFloat(event.params[1]));
+                event.params[0] = FloatToParam(mouse.x);
+                event.params[1] = FloatToParam(mouse.y);
+            }
+
+            platData->LatencyCaptureTime = queued.Time;
+            SubmitInputEvent(io, event);
+        }
+
+        // the latched position is newer than anything in the queue
+        if (platData->LatchedMouseValid && !io.WantSetMousePos)
+        {
+            platData->LatencyCaptureTime = platData->LatchedMouseTime;
+            ImVec2 mouse = MapMouseToContext(io, platData, platData->LatchedMousePos.x, platData->LatchedMousePos.y);
+            SubmitMousePosEvent(io, mouse.x, mouse.y);
+        }
+    }
+    else
+#endif
+    {
+        PollRaylibInput(io, platData);
+    }
+
+    if (io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad && IsGamepadAvailable(0))
+    {
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_FACE_UP, ImGuiKey_GamepadDpadUp);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_FACE_RIGHT, ImGuiKey_GamepadDpadRight);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_FACE_DOWN, ImGuiKey_GamepadDpadDown);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_FACE_LEFT, ImGuiKey_GamepadDpadLeft);
+
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_FACE_UP, ImGuiKey_GamepadFaceUp);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT, ImGuiKey_GamepadFaceLeft);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_FACE_DOWN, ImGuiKey_GamepadFaceDown);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_FACE_LEFT, ImGuiKey_GamepadFaceRight);
+
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_TRIGGER_1, ImGuiKey_GamepadL1);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_TRIGGER_2, ImGuiKey_GamepadL2);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_TRIGGER_1, ImGuiKey_GamepadR1);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_TRIGGER_2, ImGuiKey_GamepadR2);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_THUMB, ImGuiKey_GamepadL3);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_THUMB, ImGuiKey_GamepadR3);
+
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_MIDDLE_LEFT, ImGuiKey_GamepadStart);
+        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_MIDDLE_RIGHT, ImGuiKey_GamepadBack);
+
+        // left stick
+        HandleGamepadStickEvent(io, GAMEPAD_AXIS_LEFT_X, ImGuiKey_GamepadLStickLeft, ImGuiKey_GamepadLStickRight);
+        HandleGamepadStickEvent(io, GAMEPAD_AXIS_LEFT_Y, ImGuiKey_GamepadLStickUp, ImGuiKey_GamepadLStickDown);
+
+        // right stick
+        HandleGamepadStickEvent(io, GAMEPAD_AXIS_RIGHT_X, ImGuiKey_GamepadRStickLeft, ImGuiKey_GamepadRStickRight);
+        HandleGamepadStickEvent(io, GAMEPAD_AXIS_RIGHT_Y, ImGuiKey_GamepadRStickUp, ImGuiKey_GamepadRStickDown);
+    }
+
+    if (platData->Recording)
+        platData->RecordFrame++;
+
+    platData->LatchedMouseValid = false;
+
+    return true;
+}
+
+// input recording and replay
+struct InputRecordingHeader
+{
+    char Magic[4];
+    unsigned int Version;
+    unsigned int EventCount;
+    unsigned int FrameCount;
+};
+
+static constexpr char InputRecordingMagic[4] = { 'r', 'I', 'I', 'R' };
+static constexpr unsigned int InputRecordingVersion = 1;
+
+// reads the data of the global context without making it current, so the getters can be used between rlImGuiBeginContext and rlImGuiEndContext
+static ImGui_ImplRaylib_Data* GetGlobalBackendData(void)
+{
+    if (!GlobalContext)
+        return ImGui_ImplRaylib_GetBackendData();
+
+    return static_cast<ImGui_ImplRaylib_Data*>(ImGui::GetPlatformIO(GlobalContext).Renderer_RenderState);
+}
+
+void rlImGuiStartInputRecording(void)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (!platData)
+        return;
+
+    platData->Recorded.count = 0;
+    platData->RecordFrame = 0;
+    platData->LastRecordedDisplaySize = ImVec2(-1, -1);
+    platData->LastRecordedFramebufferScale = ImVec2(-1, -1);
+    platData->LastRecordedMousePos = ImVec2(-1, -1);
+    memset(platData->LastAnalogValue, 0, sizeof(platData->LastAnalogValue));
+    platData->Recording = true;
+
+    // start the replay from the same focus state
+    ImGuiContext* previous = ImGui::GetCurrentContext();
+    if (GlobalContext)
+        ImGui::SetCurrentContext(GlobalContext);
+    RecordInputEvent(InputEvent_Focus, platData->LastFrameFocused);
+    ImGui::SetCurrentContext(previous);
+}
+
+void rlImGuiStopInputRecording(void)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (platData)
+        platData->Recording = false;
+}
+
+bool rlImGuiIsInputRecording(void)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    return platData && platData->Recording;
+}
+
+bool rlImGuiExportInputRecording(const char* fileName)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (!platData || !fileName)
+        return false;
+
+    const AutomationEventList& list = platData->Recorded;
+
+    InputRecordingHeader header = { 0 };
+    memcpy(header.Magic, InputRecordingMagic, sizeof(header.Magic));
+    header.Version = InputRecordingVersion;
+    header.EventCount = list.count;
+    header.FrameCount = platData->RecordFrame;
+
+    unsigned int dataSize = sizeof(InputRecordingHeader) + list.count * sizeof(AutomationEvent);
+    unsigned char* data = (unsigned char*)MemAlloc(dataSize);
+    memcpy(data, &header, sizeof(InputRecordingHeader));
+    if (list.count > 0)
+        memcpy(data + sizeof(InputRecordingHeader), list.events, list.count * sizeof(AutomationEvent));
+
+    bool saved = SaveFileData(fileName, data, int(dataSize));
+    MemFree(data);
+    return saved;
+}
+
+bool rlImGuiStartInputReplay(const char* fileName)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (!platData || !fileName)
+        return false;
+
+    int dataSize = 0;
+    unsigned char* data = LoadFileData(fileName, &dataSize);
+    if (!data)
+        return false;
+
+    InputRecordingHeader header = { 0 };
+    if (dataSize >= int(sizeof(InputRecordingHeader)))
+        memcpy(&header, data, sizeof(InputRecordingHeader));
+
+    if (memcmp(header.Magic, InputRecordingMagic, sizeof(header.Magic)) != 0 || header.Version != InputRecordingVersion
+        || size_t(dataSize) < sizeof(InputRecordingHeader) + size_t(header.EventCount) * sizeof(AutomationEvent))
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Invalid input recording file", fileName);
+        UnloadFileData(data);
+        return false;
+    }
+
+    MemFree(platData->Replay.events);
+    platData->Replay.capacity = header.EventCount;
+    platData->Replay.count = header.EventCount;
+    platData->Replay.events = (AutomationEvent*)MemAlloc(header.EventCount * sizeof(AutomationEvent));
+    memcpy(platData->Replay.events, data + sizeof(InputRecordingHeader), header.EventCount * sizeof(AutomationEvent));
+    UnloadFileData(data);
+
+    platData->ReplayFrame = 0;
+    platData->ReplayFrameCount = header.FrameCount;
+    platData->ReplayCursor = 0;
+    platData->ReplayDisplaySize = ImVec2(-1, -1);
+    platData->ReplayFramebufferScale = ImVec2(1, 1);
+    platData->Replaying = header.FrameCount > 0;
+    return platData->Replaying;
+}
+
+void rlImGuiStopInputReplay(void)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (!platData)
+        return;
+
+    MemFree(platData->Replay.events);
+    platData->Replay = AutomationEventList{ 0 };
+    platData->Replaying = false;
+}
+
+bool rlImGuiIsInputReplaying(void)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    return platData && platData->Replaying;
+}
+
+// input latency
+void rlImGuiSetInputLatencyTracking(bool enabled)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (!platData)
+        return;
+
+    platData->LatencyTracking = enabled;
+    platData->LatencyPending.resize(0);
+}
+
+bool rlImGuiIsInputLatencyTracking(void)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    return platData && platData->LatencyTracking;
+}
+
+static void ResetInputLatencyStats(ImGui_ImplRaylib_Data* platData)
+{
+    platData->LatencyFrame = rlImGuiInputLatencyStats{};
+    platData->LatencyHistoryCount = 0;
+    platData->LatencyHistoryHead = 0;
+    platData->LatencyPending.resize(0);
+}
+
+void rlImGuiResetInputLatencyStats(void)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (platData)
+        ResetInputLatencyStats(platData);
+}
+
+static void GetInputLatencyStats(const ImGui_ImplRaylib_Data* platData, rlImGuiInputLatencyStats* stats)
+{
+    *stats = platData->LatencyFrame;
+    stats->SampleCount = platData->LatencyHistoryCount;
+    stats->P50Ms = stats->P90Ms = stats->P99Ms = stats->MaxMs = 0;
+
+    if (platData->LatencyHistoryCount == 0)
+        return;
+
+    float sorted[InputLatencyHistorySize];
+    memcpy(sorted, platData->LatencyHistory, platData->LatencyHistoryCount * sizeof(float));
+    std::sort(sorted, sorted + platData->LatencyHistoryCount);
+
+    // nearest rank percentiles
+    auto percentile = [&sorted, platData](float p)
+        {
+            unsigned int rank = (unsigned int)ceilf(p * platData->LatencyHistoryCount);
+            return sorted[rank > 0 ? rank - 1 : 0];
+        };
+
+    stats->P50Ms = percentile(0.50f);
+    stats->P90Ms = percentile(0.90f);
+    stats->P99Ms = percentile(0.99f);
+    stats->MaxMs = sorted[platData->LatencyHistoryCount - 1];
+}
+
+bool rlImGuiGetInputLatencyStats(rlImGuiInputLatencyStats* stats)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (!platData || !stats)
+        return false;
+
+    GetInputLatencyStats(platData, stats);
+    return true;
+}
+
+void rlImGuiShowInputLatencyOverlay(bool* open)
+{
+    // called inside the frame, so use the current context and not the global one
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (!platData || (open && !*open))
+        return;
+
+    rlImGuiInputLatencyStats stats;
+    GetInputLatencyStats(platData, &stats);
+
+    ImGui::SetNextWindowBgAlpha(0.75f);
+    if (ImGui::Begin("Input Latency", open, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav))
+    {
+        bool tracking = platData->LatencyTracking;
+        if (ImGui::Checkbox("Track", &tracking))
+        {
+            platData->LatencyTracking = tracking;
+            platData->LatencyPending.resize(0);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Reset"))
+            ResetInputLatencyStats(platData);
+
+        ImGui::SeparatorText("Last frame with input");
+        ImGui::Text("Events           %u", stats.FrameEventCount);
+        ImGui::Text("Capture->Submit  %6.2f ms", stats.FrameCaptureToSubmitMs);
+        ImGui::Text("Submit->Render   %6.2f ms", stats.FrameSubmitToRenderMs);
+        ImGui::Text("Render->Draw     %6.2f ms", stats.FrameRenderToDrawMs);
+        ImGui::Text("Total            %6.2f ms", stats.FrameTotalMs);
+
+        ImGui::SeparatorText("History");
+        ImGui::Text("Events %u  p50 %.2f  p90 %.2f  p99 %.2f  max %.2f ms", stats.SampleCount, stats.P50Ms, stats.P90Ms, stats.P99Ms, stats.MaxMs);
+
+        int offset = platData->LatencyHistoryCount < InputLatencyHistorySize ? 0 : int(platData->LatencyHistoryHead);
+        ImGui::PlotLines("##LatencyHistory", platData->LatencyHistory, int(platData->LatencyHistoryCount), offset, nullptr, 0, stats.MaxMs, ImVec2(300, 60));
+    }
+    ImGui::End();
+}
+
+// late input
+bool rlImGuiCanPollInput(void)
+{
+#if defined(RLIMGUI_GLFW_EVENTS)
+    return GlfwCallbackWindow != nullptr;
+#else
+    return false;
+#endif
+}
+
+void rlImGuiPollInput(void)
+{
+    // raylib's position would be the one the frame already uses, and would make the latency look lower than it is
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (!platData || !rlImGuiCanPollInput())
+        return;
+
+    platData->LatchedMouseValid = GetLatestMousePos(platData->LatchedMousePos);
+    platData->LatchedMouseTime = GetTime();
+}
+
+void rlImGuiSetLateSoftwareCursor(bool enabled)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    if (!platData)
+        return;
+
+    platData->LateSoftwareCursor = enabled;
+    platData->CurrentMouseCursor = ImGuiMouseCursor_COUNT;
+}
+
+bool rlImGuiIsLateSoftwareCursor(void)
+{
+    ImGui_ImplRaylib_Data* platData = GetGlobalBackendData();
+    return platData && platData->LateSoftwareCursor;
+}
+
+// font atlas
+bool rlImGuiGetFontAtlasStats(rlImGuiFontAtlasStats* stats)
+{
+    // the worker thread owns the stats until the async setup is done
+    if (!stats || PendingFontSetup)
+        return false;
+
+    *stats = TextureStats;
+    stats->ContextCount = SharedFontAtlasContexts;
+    stats->AtlasWidth = 0;
+    stats->AtlasHeight = 0;
+
+    if (SharedFontAtlas && SharedFontAtlas->TexData)
+    {
+        stats->AtlasWidth = SharedFontAtlas->TexData->Width;
+        stats->AtlasHeight = SharedFontAtlas->TexData->Height;
+    }
+    return true;
+}
+
+void rlImGuiSetFontAtlasBudget(long long bytes, int coldFrames)
+{
+    FontAtlasBudget = bytes > 0 ? bytes : 0;
+    if (coldFrames > 0)
+        FontAtlasColdFrames = coldFrames;
+    FontAtlasBudgetWarned = false;
+}
+
+void rlImGuiCompactFontAtlas(void)
+{
+    FontAtlasCompactRequested = true;
+}
+
+bool rlImGuiGetFontAtlasBudgetStats(rlImGuiFontAtlasBudgetStats* stats)
+{
+    if (!stats || PendingFontSetup)
+        return false;
+
+    *stats = FontAtlasBudgetStats;
+    stats->Budget = FontAtlasBudget;
+    stats->TextureBytes = 0;
+    stats->BakedSizes = 0;
+    stats->Glyphs = 0;
+    stats->GlyphPixels = 0;
+    stats->Occupancy = 0;
+
+    ImFontAtlas* atlas = SharedFontAtlas;
+    if (!atlas || !atlas->TexData || !atlas->Builder)
+        return true;
+
+    // the CPU copy of the atlas is the same size as the GPU texture
+    stats->TextureBytes = atlas->TexData->GetSizeInBytes();
+
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (int i = 0; i < builder->BakedPool.Size; i++)
+    {
+        ImFontBaked& baked = builder->BakedPool[i];
+        if (baked.WantDestroy)
+            continue;
+
+        stats->BakedSizes++;
+        for (const ImFontGlyph& glyph : baked.Glyphs)
+        {
+            stats->Glyphs++;
+            if (glyph.PackId == ImFontAtlasRectId_Invalid)
+                continue;
+
+            if (ImTextureRect* rect = ImFontAtlasPackGetRect(atlas, glyph.PackId))
+                stats->GlyphPixels += (long long)rect->w * rect->h;
+        }
+    }
+
+    long long texturePixels = (long long)atlas->TexData->Width * atlas->TexData->Height;
+    if (texturePixels > 0)
+        stats->Occupancy = float(double(stats->GlyphPixels) / double(texturePixels));
+    return true;
+}
+
+void rlImGuiPrewarmGlyphs(const char* text, float fontSize)
+{
+    if (!text)
+        return;
+
+    const char* end = text + strlen(text);
+    while (text < end)
+    {
+        unsigned int codepoint = 0;
+        text += ImTextCharFromUtf8(&codepoint, text, end);
+        if (codepoint > 0 && codepoint <= IM_UNICODE_CODEPOINT_MAX)
+            PendingPrewarmGlyphs.push_back(PrewarmGlyph{ fontSize, ImWchar(codepoint) });
+    }
+}
+
+void rlImGuiPrewarmGlyphRange(unsigned int first, unsigned int last, float fontSize)
+{
+    if (last > IM_UNICODE_CODEPOINT_MAX)
+        last = IM_UNICODE_CODEPOINT_MAX;
+
+    for (unsigned int codepoint = std::max(first, 1u); codepoint <= last; codepoint++)
+        PendingPrewarmGlyphs.push_back(PrewarmGlyph{ fontSize, ImWchar(codepoint) });
+}
+
+bool rlImGuiSetGlyphRecordFile(const char* fileName)
+{
+    if (SharedFontAtlasHasFonts || PendingFontSetup)
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: The glyph record file must be set before rlImGuiSetup");
+        return false;
+    }
+
+    MemFree(GlyphRecordFileName);
+    GlyphRecordFileName = nullptr;
+    if (!fileName || !fileName[0])
+        return false;
+
+    size_t nameSize = strlen(fileName) + 1;
+    GlyphRecordFileName = (char*)MemAlloc((unsigned int)nameSize);
+    memcpy(GlyphRecordFileName, fileName, nameSize);
+    return true;
+}
+
+bool rlImGuiSaveGlyphRecord(void)
+{
+    if (!GlyphRecordFileName || !SharedFontAtlas || !SharedFontAtlas->Builder)
+        return false;
+
+    // every glyph that is in a baked font was used at that size, or was pre-warmed from the last record
+    ImFontAtlas* atlas = SharedFontAtlas;
+    ImVector<GlyphRecordEntry> entries;
+    ImStableVector<ImFontBaked, 32>& bakedPool = atlas->Builder->BakedPool;
+    for (int i = 0; i < bakedPool.Size; i++)
+    {
+        ImFontBaked& baked = bakedPool[i];
+        if (baked.WantDestroy || !baked.ContainerFont)
+            continue;
+
+        int fontIndex = atlas->Fonts.index_from_ptr(atlas->Fonts.find(baked.ContainerFont));
+        if (fontIndex < 0 || fontIndex >= atlas->Fonts.Size)
+            continue;
+
+        for (const ImFontGlyph& glyph : baked.Glyphs)
+            entries.push_back(GlyphRecordEntry{ fontIndex, baked.Size, baked.RasterizerDensity, glyph.Codepoint });
+    }
+
+    GlyphRecordHeader header = { 0 };
+    memcpy(header.Magic, GlyphRecordMagic, sizeof(header.Magic));
+    header.Version = GlyphRecordVersion;
+    header.EntryCount = unsigned(entries.Size);
+
+    unsigned int dataSize = sizeof(GlyphRecordHeader) + entries.Size * sizeof(GlyphRecordEntry);
+    unsigned char* data = (unsigned char*)MemAlloc(dataSize);
+    memcpy(data, &header, sizeof(GlyphRecordHeader));
+    if (!entries.empty())
+        memcpy(data + sizeof(GlyphRecordHeader), entries.Data, entries.Size * sizeof(GlyphRecordEntry));
+
+    bool saved = SaveFileData(GlyphRecordFileName, data, int(dataSize));
+    MemFree(data);
+    return saved;
+}
+
+bool rlImGuiSetSdfFonts(bool enabled, float referenceSize)
+{
+#if defined(RLIMGUI_NO_SDF_FONTS)
+    if (enabled)
+        TraceLog(LOG_WARNING, "RLIMGUI: Distance field fonts were disabled with RLIMGUI_NO_SDF_FONTS");
+    return false;
+#else
+    if (SharedFontAtlas || PendingFontSetup)
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: Distance field fonts must be set before rlImGuiSetup");
+        return false;
+    }
+
+    SdfFontsEnabled = enabled;
+    if (referenceSize > 0)
+        SdfReferenceSize = referenceSize;
+    return true;
+#endif
+}
+
+bool rlImGuiIsSdfFonts(void)
+{
+    return SdfFontsEnabled;
+}
+
+bool rlImGuiSetFontCacheFile(const char* fileName)
+{
+    if (SharedFontAtlas || PendingFontSetup)
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: The font cache file must be set before rlImGuiSetup");
+        return false;
+    }
+
+    DestroyFontCache();
+    if (!fileName || !fileName[0])
+        return false;
+
+    double start = GetTime();
+
+    ActiveFontCache = IM_NEW(FontCache)();
+    size_t nameSize = strlen(fileName) + 1;
+    ActiveFontCache->FileName = (char*)MemAlloc((unsigned int)nameSize);
+    memcpy(ActiveFontCache->FileName, fileName, nameSize);
+    ActiveFontCache->Stats.Enabled = true;
+
+    bool loaded = MapFontCacheFile(ActiveFontCache);
+    ActiveFontCache->Stats.LoadSeconds = GetTime() - start;
+    return loaded;
+}
+
+bool rlImGuiSaveFontCache(void)
+{
+    FontCache* cache = ActiveFontCache;
+    if (!cache)
+        return false;
+
+    if (cache->NewGlyphs.empty() && cache->NewBlobs.empty())
+        return true;
+
+    const FontCacheHeader* fileHeader = cache->Header;
+    unsigned int fileGlyphs = fileHeader ? fileHeader->GlyphCount : 0;
+    unsigned int fileBlobs = fileHeader ? fileHeader->BlobCount : 0;
+    unsigned int filePixelBytes = fileHeader ? fileHeader->PixelBytes : 0;
+    unsigned int fileBlobBytes = fileHeader ? fileHeader->BlobBytes : 0;
+
+    FontCacheHeader header = { 0 };
+    memcpy(header.Magic, FontCacheMagic, sizeof(header.Magic));
+    header.Version = FontCacheVersion;
+    header.ImGuiVersion = IMGUI_VERSION_NUM;
+    header.GlyphCount = fileGlyphs + unsigned(cache->NewGlyphs.Size);
+    header.BlobCount = fileBlobs + unsigned(cache->NewBlobs.Size);
+    header.PixelBytes = filePixelBytes + unsigned(cache->NewPixels.Size);
+    header.BlobBytes = fileBlobBytes + unsigned(cache->NewBlobData.Size);
+
+    size_t dataSize = sizeof(FontCacheHeader) + header.GlyphCount * sizeof(FontCacheGlyph) + header.BlobCount * sizeof(FontCacheBlob)
+        + header.PixelBytes + header.BlobBytes;
+    if (dataSize > size_t(std::numeric_limits<int>::max()))
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Font cache is too large to save", cache->FileName);
+        return false;
+    }
+
+    // the glyphs and blobs from the file are kept, the new ones are added after them
+    unsigned char* data = (unsigned char*)MemAlloc((unsigned int)dataSize);
+    unsigned char* write = data;
+    memcpy(write, &header, sizeof(header));
+    write += sizeof(header);
+
+    if (fileGlyphs > 0)
+        memcpy(write, cache->Glyphs, fileGlyphs * sizeof(FontCacheGlyph));
+    write += fileGlyphs * sizeof(FontCacheGlyph);
+    for (FontCacheGlyph glyph : cache->NewGlyphs)
+    {
+        glyph.PixelOffset += filePixelBytes;
+        memcpy(write, &glyph, sizeof(glyph));
+        write += sizeof(glyph);
+    }
+
+    if (fileBlobs > 0)
+        memcpy(write, cache->Blobs, fileBlobs * sizeof(FontCacheBlob));
+    write += fileBlobs * sizeof(FontCacheBlob);
+    for (FontCacheBlob blob : cache->NewBlobs)
+    {
+        blob.Offset += fileBlobBytes;
+        memcpy(write, &blob, sizeof(blob));
+        write += sizeof(blob);
+    }
+
+    if (filePixelBytes > 0)
+        memcpy(write, cache->Pixels, filePixelBytes);
+    write += filePixelBytes;
+    if (!cache->NewPixels.empty())
+        memcpy(write, cache->NewPixels.Data, cache->NewPixels.Size);
+    write += cache->NewPixels.Size;
+
+    if (fileBlobBytes > 0)
+        memcpy(write, cache->BlobData, fileBlobBytes);
+    write += fileBlobBytes;
+    if (!cache->NewBlobData.empty())
+        memcpy(write, cache->NewBlobData.Data, cache->NewBlobData.Size);
+
+    // write a new file and move it over the old one, the old file may still be mapped
+    size_t nameSize = strlen(cache->FileName) + 5;
+    char* tempName = (char*)MemAlloc((unsigned int)nameSize);
+    snprintf(tempName, nameSize, "%s.tmp", cache->FileName);
+
+    bool saved = SaveFileData(tempName, data, int(dataSize));
+    MemFree(data);
+
+    if (saved && std::rename(tempName, cache->FileName) != 0)
+    {
+        std::remove(cache->FileName);
+        saved = std::rename(tempName, cache->FileName) == 0;
+    }
+    if (!saved)
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Font cache could not be saved", cache->FileName);
+
+    MemFree(tempName);
+    return saved;
+}
+
+bool rlImGuiGetFontCacheStats(rlImGuiFontCacheStats* stats)
+{
+    if (!stats || PendingFontSetup)
+        return false;
+
+    if (!ActiveFontCache)
+    {
+        *stats = rlImGuiFontCacheStats{};
+        return true;
+    }
+
+    *stats = ActiveFontCache->Stats;
+    return true;
+}
+
+// world panels
+struct rlImGuiWorldPanel
+{
+    rlImGuiContext* Context = nullptr;
+    RenderTexture Target = { 0 };
+    Vector3 Corners[4] = {};
+
+    float RefreshInterval = 0;
+    double LastRefresh = -1;
+    bool Dirty = true;
+    int SettleRefreshes = 0;
+    bool Scheduled = false;
+
+    bool Hovered = false;
+    ImVec2 LastMouse = ImVec2(-1, -1);
+    int ButtonsDown = 0;
+};
+
+static ImVector<rlImGuiWorldPanel*> WorldPanels;
+static rlImGuiWorldPanel* FocusedWorldPanel = nullptr;
+static int WorldPanelBudget = 0;
+static rlImGuiWorldPanelStats WorldPanelStats = {};
+
+// ImGui shows hover and active state changes one frame late, so a panel is drawn a few more times after the input stops
+static constexpr int WorldPanelSettleRefreshes = 2;
+
+static constexpr int WorldPanelMouseButtons[][2] =
+{
+    { MOUSE_BUTTON_LEFT, ImGuiMouseButton_Left },
+    { MOUSE_BUTTON_RIGHT, ImGuiMouseButton_Right },
+    { MOUSE_BUTTON_MIDDLE, ImGuiMouseButton_Middle },
+    { MOUSE_BUTTON_FORWARD, ImGuiMouseButton_Middle + 1 },
+    { MOUSE_BUTTON_BACK, ImGuiMouseButton_Middle + 2 },
+};
+
+rlImGuiWorldPanel* rlImGuiCreateWorldPanel(int width, int height, bool darkTheme)
+{
+    rlImGuiContext* context = rlImGuiCreateContext(darkTheme);
+    if (!context)
+        return nullptr;
+
+    rlImGuiWorldPanel* panel = IM_NEW(rlImGuiWorldPanel)();
+    panel->Context = context;
+    panel->Target = LoadRenderTexture(width, height);
+    SetTextureFilter(panel->Target.texture, TEXTURE_FILTER_BILINEAR);
+
+    // a 1x1 quad on the XY plane, facing +Z
+    panel->Corners[0] = Vector3{ -0.5f, 0.5f, 0 };
+    panel->Corners[1] = Vector3{ -0.5f, -0.5f, 0 };
+    panel->Corners[2] = Vector3{ 0.5f, -0.5f, 0 };
+    panel->Corners[3] = Vector3{ 0.5f, 0.5f, 0 };
+
+    rlImGuiSetContextTarget(context, &panel->Target);
+
+    ImGuiContext* previous = ImGui::GetCurrentContext();
+    ImGui::SetCurrentContext(context->Context);
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (platData)
+        platData->ExternalInput = true;
+    ImGui::SetCurrentContext(previous);
+
+    WorldPanels.push_back(panel);
+    return panel;
+}
+
+void rlImGuiDestroyWorldPanel(rlImGuiWorldPanel* panel)
+{
+    if (!panel)
+        return;
+
+    if (FocusedWorldPanel == panel)
+        FocusedWorldPanel = nullptr;
+
+    WorldPanels.find_erase(panel);
+    rlImGuiDestroyContext(panel->Context);
+    UnloadRenderTexture(panel->Target);
+    IM_DELETE(panel);
+}
+
+void rlImGuiSetWorldPanelQuad(rlImGuiWorldPanel* panel, Vector3 topLeft, Vector3 bottomLeft, Vector3 bottomRight, Vector3 topRight)
+{
+    if (!panel)
+        return;
+
+    panel->Corners[0] = topLeft;
+    panel->Corners[1] = bottomLeft;
+    panel->Corners[2] = bottomRight;
+    panel->Corners[3] = topRight;
+}
+
+void rlImGuiSetWorldPanelRefreshInterval(rlImGuiWorldPanel* panel, float seconds)
+{
+    if (panel)
+        panel->RefreshInterval = seconds > 0 ? seconds : 0;
+}
+
+void rlImGuiMarkWorldPanelDirty(rlImGuiWorldPanel* panel)
+{
+    if (panel)
+        panel->Dirty = true;
+}
+
+void rlImGuiSetWorldPanelBudget(int panelsPerFrame)
+{
+    WorldPanelBudget = panelsPerFrame > 0 ? panelsPerFrame : 0;
+}
+
+bool rlImGuiIsWorldPanelHovered(const rlImGuiWorldPanel* panel)
+{
+    return panel && panel->Hovered;
+}
+
+Texture rlImGuiGetWorldPanelTexture(const rlImGuiWorldPanel* panel)
+{
+    return panel ? panel->Target.texture : Texture{ 0 };
+}
+
+static Vector3 WorldPanelSub(Vector3 a, Vector3 b)
+{
+    return Vector3{ a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+static float WorldPanelDot(Vector3 a, Vector3 b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// maps a point on the panel quad to ImGui pixels, the quad is treated as a parallelogram from the top left corner
+static ImVec2 WorldPanelPointToPixels(const rlImGuiWorldPanel* panel, Vector3 point)
+{
+    Vector3 right = WorldPanelSub(panel->Corners[3], panel->Corners[0]);
+    Vector3 down = WorldPanelSub(panel->Corners[1], panel->Corners[0]);
+    Vector3 local = WorldPanelSub(point, panel->Corners[0]);
+
+    float rightLen = WorldPanelDot(right, right);
+    float downLen = WorldPanelDot(down, down);
+    float u = rightLen > 0 ? WorldPanelDot(local, right) / rightLen : 0;
+    float v = downLen > 0 ? WorldPanelDot(local, down) / downLen : 0;
+
+    return ImVec2(u * panel->Target.texture.width, v * panel->Target.texture.height);
+}
+
+static void UpdateWorldPanelInput(rlImGuiWorldPanel* panel, bool hovered, Vector3 hitPoint, bool keyboard)
+{
+    ImGui::SetCurrentContext(panel->Context->Context);
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplRaylib_Data* platData = ImGui_ImplRaylib_GetBackendData();
+    if (!platData)
+        return;
+
+    platData->LatencyCaptureTime = platData->LatencyLastDrawTime > 0 ? platData->LatencyLastDrawTime : GetTime();
+
+    if (hovered)
+    {
+        ImVec2 mouse = WorldPanelPointToPixels(panel, hitPoint);
+        if (!panel->Hovered || mouse.x != panel->LastMouse.x || mouse.y != panel->LastMouse.y)
+        {
+            SubmitMousePosEvent(io, mouse.x, mouse.y);
+            panel->LastMouse = mouse;
+            panel->Dirty = true;
+        }
+
+        Vector2 wheel = GetMouseWheelMoveV();
+        if (wheel.x != 0 || wheel.y != 0)
+        {
+            SubmitMouseWheelEvent(io, wheel.x, wheel.y);
+            panel->Dirty = true;
+        }
+    }
+    else if (panel->Hovered)
+    {
+        SubmitMousePosEvent(io, -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+        panel->Dirty = true;
+    }
+    panel->Hovered = hovered;
+
+    // presses only go to the hovered panel, but releases always go to the panel that saw the press so nothing stays held
+    for (const auto& button : WorldPanelMouseButtons)
+    {
+        int mask = 1 << button[1];
+        if (hovered && IsMouseButtonPressed(button[0]))
+        {
+            SubmitMouseButtonEvent(io, button[1], true);
+            panel->ButtonsDown |= mask;
+            panel->Dirty = true;
+        }
+        else if ((panel->ButtonsDown & mask) && IsMouseButtonReleased(button[0]))
+        {
+            SubmitMouseButtonEvent(io, button[1], false);
+            panel->ButtonsDown &= ~mask;
+            panel->Dirty = true;
+        }
+    }
+
+    if (keyboard)
+    {
+        PollRaylibKeyboard(io, platData);
+
+        // the panel gets the key and text input from the log, the mouse was handled above
+        unsigned int sent = platData->NextPolledInput;
+        SendPolledInput(io, platData, false, true);
+
+        // typing and the text cursor need the panel to keep drawing
+        if (io.WantCaptureKeyboard || platData->NextPolledInput != sent)
+            panel->Dirty = true;
+    }
+    else
+    {
+        // panels without the keyboard do not get what was typed into another one once they are picked
+        SkipPolledInput(platData);
+    }
+}
+
+void rlImGuiUpdateWorldPanels(Ray ray)
+{
+    if (WorldPanels.empty())
+        return;
+
+    ImGuiContext* previous = ImGui::GetCurrentContext();
+
+    // a desktop window over the 3D view keeps the mouse, panels behind it are not hovered or clicked
+    bool mouseOverUI = GlobalContext && ImGui::GetIO(GlobalContext).WantCaptureMouse;
+
+    // only the closest panel under the ray gets the mouse
+    rlImGuiWorldPanel* hit = nullptr;
+    RayCollision hitCollision = { 0 };
+    for (rlImGuiWorldPanel* panel : WorldPanels)
+    {
+        if (mouseOverUI)
+            break;
+
+        RayCollision collision = GetRayCollisionQuad(ray, panel->Corners[0], panel->Corners[1], panel->Corners[2], panel->Corners[3]);
+        if (collision.hit && (!hit || collision.distance < hitCollision.distance))
+        {
+            hit = panel;
+            hitCollision = collision;
+        }
+    }
+
+    // a click picks the panel that gets the keyboard
+    for (const auto& button : WorldPanelMouseButtons)
+    {
+        if (!mouseOverUI && IsMouseButtonPressed(button[0]))
+        {
+            FocusedWorldPanel = hit;
+            break;
+        }
+    }
+
+    for (rlImGuiWorldPanel* panel : WorldPanels)
+        UpdateWorldPanelInput(panel, panel == hit, hitCollision.point, panel == FocusedWorldPanel);
+
+    ImGui::SetCurrentContext(previous);
+
+    // pick the panels to draw this frame, the ones that waited longest go first
+    double now = GetTime();
+    ImVector<rlImGuiWorldPanel*> ready;
+    for (rlImGuiWorldPanel* panel : WorldPanels)
+    {
+        panel->Scheduled = false;
+        if (!panel->Dirty && panel->SettleRefreshes <= 0)
+            continue;
+
+        if (panel->LastRefresh >= 0 && now - panel->LastRefresh < panel->RefreshInterval)
+            continue;
+
+        ready.push_back(panel);
+    }
+
+    std::sort(ready.begin(), ready.end(), [](const rlImGuiWorldPanel* a, const rlImGuiWorldPanel* b) { return a->LastRefresh < b->LastRefresh; });
+
+    int count = WorldPanelBudget > 0 ? ImMin(WorldPanelBudget, ready.Size) : ready.Size;
+    for (int i = 0; i < count; i++)
+        ready[i]->Scheduled = true;
+
+    WorldPanelStats.PanelCount = WorldPanels.Size;
+    WorldPanelStats.ReadyCount = ready.Size;
+    WorldPanelStats.ScheduledCount = count;
+}
+
+bool rlImGuiBeginWorldPanel(rlImGuiWorldPanel* panel)
+{
+    if (!panel || !panel->Scheduled)
+        return false;
+
+    double now = GetTime();
+    float delta = panel->LastRefresh >= 0 ? float(now - panel->LastRefresh) : GetFrameTime();
+    rlImGuiBeginContextDelta(panel->Context, delta);
+    return true;
+}
+
+void rlImGuiEndWorldPanel(rlImGuiWorldPanel* panel)
+{
+    if (!panel)
+        return;
+
+    // anything that is being dragged or edited keeps changing without new input
+    bool active = ImGui::IsAnyItemActive();
+
+    rlImGuiEndContext(panel->Context);
+
+    panel->LastRefresh = GetTime();
+    panel->Scheduled = false;
+
+    if (panel->Dirty || active)
+        panel->SettleRefreshes = WorldPanelSettleRefreshes;
+    else if (panel->SettleRefreshes > 0)
+        panel->SettleRefreshes--;
+
+    panel->Dirty = active;
+    WorldPanelStats.RefreshCount++;
+}
+
+void rlImGuiDrawWorldPanel(const rlImGuiWorldPanel* panel, Color tint)
+{
+    if (!panel)
+        return;
+
+    // render textures are upside down
+    static constexpr float uvs[4][2] = { { 0, 1 }, { 0, 0 }, { 1, 0 }, { 1, 1 } };
+
+    rlDisableBackfaceCulling();
+    rlSetTexture(panel->Target.texture.id);
+    rlBegin(RL_QUADS);
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    for (int i = 0; i < 4; i++)
+    {
+        rlTexCoord2f(uvs[i][0], uvs[i][1]);
+        rlVertex3f(panel->Corners[i].x, panel->Corners[i].y, panel->Corners[i].z);
+    }
+    rlEnd();
+    rlSetTexture(0);
+    rlDrawRenderBatchActive();
+    rlEnableBackfaceCulling();
+}
+
+static void DestroyWorldPanels(void)
+{
+    while (!WorldPanels.empty())
+        rlImGuiDestroyWorldPanel(WorldPanels.back());
+    WorldPanels.clear();
+}
+
+bool rlImGuiGetWorldPanelStats(rlImGuiWorldPanelStats* stats)
+{
+    if (!stats)
+        return false;
+
+    *stats = WorldPanelStats;
+    return true;
+}
+
+// image atlas
+// Small images are copied into shared render texture pages, so images next to each other use the same texture
+// and ImGui puts them in one draw command. All GPU work is done in rlImGuiEnd after the draw data is rendered, so pages never change while ImGui draws from them.
+struct ImageAtlasPage
+{
+    RenderTexture Target = { 0 };
+    int CursorX = 0;
+    int ShelfY = 0;
+    int ShelfHeight = 0;
+    long long UsedPixels = 0;
+};
+
+struct rlImGuiAtlasImage
+{
+    Texture Source = { 0 };     // texture registered by the user, they own it
+    Image Pixels = { 0 };       // copy of an image registered by the user
+    Texture Fallback = { 0 };   // drawn for an image that is not in a page
+    int Width = 0;
+    int Height = 0;
+
+    int Page = -1;
+    Rectangle Rect = { 0 };
+    bool NeedsCopy = false;
+    bool Evicted = false;
+    int LastUsedFrame = 0;
+};
+
+static constexpr int ImageAtlasPadding = 1;
+
+static ImVector<rlImGuiAtlasImage*> AtlasImages;
+static ImVector<ImageAtlasPage> AtlasPages;
+static int ImageAtlasPageSize = 1024;
+static int ImageAtlasMaxPages = 4;
+static int ImageAtlasColdFrames = 600;
+static int ImageAtlasFrame = 0;
+static int ImageAtlasLastRepackFrame = -1;
+static bool ImageAtlasRepackRequested = false;
+static rlImGuiImageAtlasStats ImageAtlasStats = {};
+static int ImageAtlasFrameAtlasDraws = 0;
+static int ImageAtlasFrameDirectDraws = 0;
+
+// images bigger than half a page would crowd out the small ones, they are always drawn from their own texture
+static bool FitsImageAtlas(const rlImGuiAtlasImage* image)
+{
+    int limit = ImageAtlasPageSize / 2;
+    return image->Width > 0 && image->Height > 0 && image->Width <= limit && image->Height <= limit;
+}
+
+// next fit shelf packing, thumbnails and icons are mostly the same height so little space is lost
+static bool PackImageInPage(ImageAtlasPage& page, rlImGuiAtlasImage* image)
+{
+    int width = image->Width + ImageAtlasPadding;
+    int height = image->Height + ImageAtlasPadding;
+
+    if (page.CursorX + width > ImageAtlasPageSize)
+    {
+        page.ShelfY += page.ShelfHeight;
+        page.CursorX = 0;
+        page.ShelfHeight = 0;
+    }
+
+    if (page.ShelfY + height > ImageAtlasPageSize)
+        return false;
+
+    image->Rect = Rectangle{ float(page.CursorX), float(page.ShelfY), float(image->Width), float(image->Height) };
+    page.CursorX += width;
+    if (height > page.ShelfHeight)
+        page.ShelfHeight = height;
+    page.UsedPixels += (long long)image->Width * image->Height;
+    return true;
+}
+
+static bool PackAtlasImage(rlImGuiAtlasImage* image)
+{
+    for (int i = 0; i < AtlasPages.Size; i++)
+    {
+        if (PackImageInPage(AtlasPages[i], image))
+        {
+            image->Page = i;
+            image->NeedsCopy = true;
+            return true;
+        }
+    }
+
+    if (AtlasPages.Size >= ImageAtlasMaxPages)
+        return false;
+
+    ImageAtlasPage page;
+    page.Target = LoadRenderTexture(ImageAtlasPageSize, ImageAtlasPageSize);
+    if (page.Target.id == 0)
+        return false;
+
+    BeginTextureMode(page.Target);
+    ClearBackground(BLANK);
+    EndTextureMode();
+
+    AtlasPages.push_back(page);
+    if (!PackImageInPage(AtlasPages.back(), image))
+        return false;
+
+    image->Page = AtlasPages.Size - 1;
+    image->NeedsCopy = true;
+    return true;
+}
+
+static void ReleaseAtlasImageSlot(rlImGuiAtlasImage* image)
+{
+    if (image->Page >= 0 && image->Page < AtlasPages.Size)
+        AtlasPages[image->Page].UsedPixels -= (long long)image->Width * image->Height;
+    image->Page = -1;
+    image->NeedsCopy = false;
+}
+
+// textures are drawn into the page on the GPU, images are uploaded from their CPU copy
+static void CopyPendingAtlasImages(void)
+{
+    for (int pageIndex = 0; pageIndex < AtlasPages.Size; pageIndex++)
+    {
+        ImageAtlasPage& page = AtlasPages[pageIndex];
+        bool drawing = false;
+
+        for (rlImGuiAtlasImage* image : AtlasImages)
+        {
+            if (image->Page != pageIndex || !image->NeedsCopy)
+                continue;
+
+            if (image->Source.id != 0)
+            {
+                if (!drawing)
+                {
+                    // replace the pixels in the page instead of blending over them
+                    BeginTextureMode(page.Target);
+                    rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+                    BeginBlendMode(BLEND_CUSTOM);
+                    drawing = true;
+                }
+
+                // render textures are upside down, so the image is drawn flipped to be upright in the page
+                Rectangle dest = { image->Rect.x, ImageAtlasPageSize - image->Rect.y - image->Rect.height, image->Rect.width, image->Rect.height };
+                DrawTexturePro(image->Source, Rectangle{ 0, 0, float(image->Width), -float(image->Height) }, dest, Vector2{ 0, 0 }, 0, WHITE);
+                ImageAtlasStats.GpuCopies++;
+            }
+            else if (image->Pixels.data)
+            {
+                UpdateTextureRec(page.Target.texture, image->Rect, image->Pixels.data);
+                ImageAtlasStats.Uploads++;
+            }
+
+            image->NeedsCopy = false;
+        }
+
+        if (drawing)
+        {
+            EndBlendMode();
+            EndTextureMode();
+        }
+    }
+}
+
+// cold images are evicted and everything else is packed again from the start, which gets back the space of removed images
+static void RepackImageAtlas(void)
+{
+    ImVector<rlImGuiAtlasImage*> keep;
+    for (rlImGuiAtlasImage* image : AtlasImages)
+    {
+        if (image->Page >= 0 && image->LastUsedFrame + ImageAtlasColdFrames <= ImageAtlasFrame)
+        {
+            image->Evicted = true;
+            ImageAtlasStats.Evictions++;
+        }
+
+        image->Page = -1;
+        image->NeedsCopy = false;
+        if (!image->Evicted && FitsImageAtlas(image))
+            keep.push_back(image);
+    }
+
+    // tallest first packs shelves with the least waste
+    std::sort(keep.begin(), keep.end(), [](const rlImGuiAtlasImage* a, const rlImGuiAtlasImage* b) { return a->Height > b->Height; });
+
+    for (ImageAtlasPage& page : AtlasPages)
+    {
+        page.CursorX = 0;
+        page.ShelfY = 0;
+        page.ShelfHeight = 0;
+        page.UsedPixels = 0;
+
+        BeginTextureMode(page.Target);
+        ClearBackground(BLANK);
+        EndTextureMode();
+    }
+
+    for (rlImGuiAtlasImage* image : keep)
+        PackAtlasImage(image);
+
+    // pages nothing was packed into are freed
+    while (!AtlasPages.empty() && AtlasPages.back().UsedPixels == 0)
+    {
+        UnloadRenderTexture(AtlasPages.back().Target);
+        AtlasPages.pop_back();
+    }
+
+    ImageAtlasLastRepackFrame = ImageAtlasFrame;
+    ImageAtlasRepackRequested = false;
+    ImageAtlasStats.Repacks++;
+}
+
+// frames are counted once by EndSharedFrame and not by each context, extra contexts and world panels can begin many times in a frame
+static void EndImageAtlasFrame(void)
+{
+    ImageAtlasFrame++;
+    ImageAtlasStats.AtlasDraws = ImageAtlasFrameAtlasDraws;
+    ImageAtlasStats.DirectDraws = ImageAtlasFrameDirectDraws;
+    ImageAtlasFrameAtlasDraws = 0;
+    ImageAtlasFrameDirectDraws = 0;
+}
+
+// the page work runs after ImGui has drawn, which can be inside a render texture or a 2D or 3D mode of the caller,
+// and BeginTextureMode and EndTextureMode reset the target and the matrices, so everything is put back after it
+struct SavedRenderTarget
+{
+    unsigned int Framebuffer;
+    int Width;
+    int Height;
+    Matrix Projection;
+    Matrix Modelview;
+};
+
+static SavedRenderTarget SaveRenderTarget(void)
+{
+    rlDrawRenderBatchActive();
+
+    SavedRenderTarget saved;
+    saved.Framebuffer = rlGetActiveFramebuffer();
+    saved.Width = rlGetFramebufferWidth();
+    saved.Height = rlGetFramebufferHeight();
+    saved.Projection = rlGetMatrixProjection();
+    saved.Modelview = rlGetMatrixModelview();
+    return saved;
+}
+
+static void RestoreRenderTarget(const SavedRenderTarget& saved)
+{
+    rlDrawRenderBatchActive();
+
+    // EndTextureMode already went back to the screen
+    if (saved.Framebuffer != 0)
+    {
+        rlEnableFramebuffer(saved.Framebuffer);
+        rlViewport(0, 0, saved.Width, saved.Height);
+        rlSetFramebufferWidth(saved.Width);
+        rlSetFramebufferHeight(saved.Height);
+    }
+
+    rlSetMatrixProjection(saved.Projection);
+    rlSetMatrixModelview(saved.Modelview);
+}
+
+static void UpdateImageAtlas(void)
+{
+    if (AtlasImages.empty())
+        return;
+
+    SavedRenderTarget target = SaveRenderTarget();
+
+    bool full = false;
+    for (rlImGuiAtlasImage* image : AtlasImages)
+    {
+        if (image->Page < 0 && !image->Evicted && FitsImageAtlas(image) && !PackAtlasImage(image))
+            full = true;
+    }
+
+    // a full atlas is repacked at most once every cold frames, so a set of hot images that does not fit is not repacked every frame
+    if (ImageAtlasRepackRequested || (full && (ImageAtlasLastRepackFrame < 0 || ImageAtlasFrame - ImageAtlasLastRepackFrame >= ImageAtlasColdFrames)))
+        RepackImageAtlas();
+
+    CopyPendingAtlasImages();
+    RestoreRenderTarget(target);
+
+    // images that are drawn outside of a page need a texture of their own
+    for (rlImGuiAtlasImage* image : AtlasImages)
+    {
+        if (image->Page < 0 && !image->Evicted && image->Pixels.data && image->Fallback.id == 0)
+            image->Fallback = LoadTextureFromImage(image->Pixels);
+        else if (image->Page >= 0 && image->Fallback.id != 0)
+        {
+            UnloadTexture(image->Fallback);
+            image->Fallback = Texture{ 0 };
+        }
+    }
+}
+
+// the texture and UVs to draw an atlas image with this frame
+static bool GetAtlasImageTexture(rlImGuiAtlasImage* image, ImTextureID& textureId, ImVec2& uv0, ImVec2& uv1)
+{
+    if (!image)
+        return false;
+
+    image->LastUsedFrame = ImageAtlasFrame;
+    image->Evicted = false;
+
+    if (image->Page >= 0 && !image->NeedsCopy)
+    {
+        const float pageSize = float(ImageAtlasPageSize);
+        textureId = ImTextureID(AtlasPages[image->Page].Target.texture.id);
+        uv0 = ImVec2(image->Rect.x / pageSize, image->Rect.y / pageSize);
+        uv1 = ImVec2((image->Rect.x + image->Rect.width) / pageSize, (image->Rect.y + image->Rect.height) / pageSize);
+        ImageAtlasFrameAtlasDraws++;
+        return true;
+    }
+
+    // not in a page yet, drawn from its own texture
+    const Texture& texture = image->Source.id != 0 ? image->Source : image->Fallback;
+    if (texture.id == 0)
+        return false;
+
+    textureId = ImTextureID(texture.id);
+    uv0 = ImVec2(0, 0);
+    uv1 = ImVec2(1, 1);
+    ImageAtlasFrameDirectDraws++;
+    return true;
+}
+
+static void DestroyImageAtlas(void)
+{
+    while (!AtlasImages.empty())
+        rlImGuiAtlasRemove(AtlasImages.back());
+
+    for (ImageAtlasPage& page : AtlasPages)
+        UnloadRenderTexture(page.Target);
+    AtlasPages.clear();
+    ImageAtlasLastRepackFrame = -1;
+    ImageAtlasRepackRequested = false;
+}
+
+void rlImGuiSetImageAtlasLimits(int pageSize, int maxPages, int coldFrames)
+{
+    // the page size can only change while there are no pages
+    if (pageSize > 0 && AtlasPages.empty())
+        ImageAtlasPageSize = pageSize;
+    if (maxPages > 0)
+        ImageAtlasMaxPages = maxPages;
+    if (coldFrames > 0)
+        ImageAtlasColdFrames = coldFrames;
+
+    if (AtlasPages.Size > ImageAtlasMaxPages)
+        ImageAtlasRepackRequested = true;
+}
+
+rlImGuiAtlasImage* rlImGuiAtlasAddTexture(const Texture* texture)
+{
+    if (!texture || texture->id == 0)
+        return nullptr;
+
+    rlImGuiAtlasImage* image = IM_NEW(rlImGuiAtlasImage)();
+    image->Source = *texture;
+    image->Width = texture->width;
+    image->Height = texture->height;
+    AtlasImages.push_back(image);
+    return image;
+}
+
+rlImGuiAtlasImage* rlImGuiAtlasAddImage(const Image* pixels)
+{
+    if (!pixels || !pixels->data || pixels->width <= 0 || pixels->height <= 0)
+        return nullptr;
+
+    rlImGuiAtlasImage* image = IM_NEW(rlImGuiAtlasImage)();
+    image->Pixels = ImageCopy(*pixels);
+    ImageFormat(&image->Pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    image->Width = pixels->width;
+    image->Height = pixels->height;
+    AtlasImages.push_back(image);
+    return image;
+}
+
+void rlImGuiAtlasRemove(rlImGuiAtlasImage* image)
+{
+    if (!image)
+        return;
+
+    ReleaseAtlasImageSlot(image);
+    AtlasImages.find_erase_unsorted(image);
+
+    if (image->Pixels.data)
+        UnloadImage(image->Pixels);
+    if (image->Fallback.id != 0)
+        UnloadTexture(image->Fallback);
+    IM_DELETE(image);
+}
+
+void rlImGuiImageFromAtlas(rlImGuiAtlasImage* image)
+{
+    if (!image)
+        return;
+
+    rlImGuiImageFromAtlasSize(image, Vector2{ float(image->Width), float(image->Height) });
+}
+
+void rlImGuiImageFromAtlasSize(rlImGuiAtlasImage* image, Vector2 size)
+{
+    if (!image)
+        return;
+
+    SetFrameContext();
+
+    ImTextureID textureId;
+    ImVec2 uv0, uv1;
+    if (GetAtlasImageTexture(image, textureId, uv0, uv1))
+        ImGui::Image(textureId, ImVec2(size.x, size.y), uv0, uv1);
+    else
+        ImGui::Dummy(ImVec2(size.x, size.y));
+}
+
+bool rlImGuiImageButtonFromAtlas(const char* name, rlImGuiAtlasImage* image, Vector2 size)
+{
+    if (!image)
+        return false;
+
+    SetFrameContext();
+
+    ImTextureID textureId;
+    ImVec2 uv0, uv1;
+    if (GetAtlasImageTexture(image, textureId, uv0, uv1))
+        return ImGui::ImageButton(name, textureId, ImVec2(size.x, size.y), uv0, uv1);
+
+    return ImGui::Button(name, ImVec2(size.x, size.y));
+}
+
+void rlImGuiCompactImageAtlas(void)
+{
+    ImageAtlasRepackRequested = true;
+}
+
+bool rlImGuiGetImageAtlasStats(rlImGuiImageAtlasStats* stats)
+{
+    if (!stats)
+        return false;
+
+    *stats = ImageAtlasStats;
+    stats->Pages = AtlasPages.Size;
+    stats->PageSize = ImageAtlasPageSize;
+    stats->Images = AtlasImages.Size;
+    stats->ImagesInPages = 0;
+    stats->UsedPixels = 0;
+    stats->Occupancy = 0;
+
+    for (const rlImGuiAtlasImage* image : AtlasImages)
+    {
+        if (image->Page >= 0)
+            stats->ImagesInPages++;
+    }
+
+    for (const ImageAtlasPage& page : AtlasPages)
+        stats->UsedPixels += page.UsedPixels;
+
+    long long pagePixels = (long long)AtlasPages.Size * ImageAtlasPageSize * ImageAtlasPageSize;
+    if (pagePixels > 0)
+        stats->Occupancy = float(double(stats->UsedPixels) / double(pagePixels));
+    return true;
+}
+
+// render texture pool
+// Textures are made in sizes rounded up to the bucket size, and a released texture is kept to be reused by the next
+// request it fits. Textures that are not used for the keep frames are unloaded at the end of a frame.
+struct PooledRenderTexture
+{
+    RenderTexture Target = { 0 };
+    int ContentWidth = 0;       // the part of the texture that was drawn, from the bottom left in GL coordinates
+    int ContentHeight = 0;
+    bool InUse = false;
+    unsigned int LastUsedFrame = 0;
+};
+
+static ImVector<PooledRenderTexture*> RenderTexturePool;
+static int RenderTexturePoolBucket = 128;
+static int RenderTexturePoolKeepFrames = 120;
+static int RenderTexturePoolSettleFrames = 15;
+static unsigned int RenderTexturePoolFrame = 0;
+static rlImGuiRenderTexturePoolStats RenderTexturePoolStats = {};
+
+// a free texture can be up to this much bigger than the bucketed request and still be reused
+static constexpr float RenderTexturePoolWaste = 1.5f;
+
+// raylib render textures have a color and a depth buffer, both 32 bits per pixel
+static long long GetRenderTextureBytes(const RenderTexture& target)
+{
+    return (long long)target.texture.width * target.texture.height * 8;
+}
+
+static int RoundUpToBucket(int value)
+{
+    return ((ImMax(value, 1) + RenderTexturePoolBucket - 1) / RenderTexturePoolBucket) * RenderTexturePoolBucket;
+}
+
+static PooledRenderTexture* FindPooledRenderTexture(const RenderTexture* texture)
+{
+    for (PooledRenderTexture* pooled : RenderTexturePool)
+    {
+        if (&pooled->Target == texture)
+            return pooled;
+    }
+    return nullptr;
+}
+
+static PooledRenderTexture* AcquirePooledRenderTexture(int width, int height)
+{
+    int bucketWidth = RoundUpToBucket(width);
+    int bucketHeight = RoundUpToBucket(height);
+    long long limit = (long long)(bucketWidth * (double)bucketHeight * RenderTexturePoolWaste);
+
+    // the smallest free texture that fits
+    PooledRenderTexture* best = nullptr;
+    for (PooledRenderTexture* pooled : RenderTexturePool)
+    {
+        if (pooled->InUse || pooled->Target.texture.width < width || pooled->Target.texture.height < height)
+            continue;
+
+        long long area = (long long)pooled->Target.texture.width * pooled->Target.texture.height;
+        if (area > limit)
+            continue;
+
+        if (!best || area < (long long)best->Target.texture.width * best->Target.texture.height)
+            best = pooled;
+    }
+
+    if (best)
+    {
+        RenderTexturePoolStats.Reuses++;
+    }
+    else
+    {
+        best = IM_NEW(PooledRenderTexture)();
+        best->Target = LoadRenderTexture(bucketWidth, bucketHeight);
+        SetTextureFilter(best->Target.texture, TEXTURE_FILTER_BILINEAR);
+        RenderTexturePool.push_back(best);
+        RenderTexturePoolStats.Loads++;
+    }
+
+    best->InUse = true;
+    best->ContentWidth = width;
+    best->ContentHeight = height;
+    best->LastUsedFrame = RenderTexturePoolFrame;
+    return best;
+}
+
+static void ReleasePooledRenderTexture(PooledRenderTexture* pooled)
+{
+    if (!pooled)
+        return;
+
+    pooled->InUse = false;
+    pooled->LastUsedFrame = RenderTexturePoolFrame;
+}
+
+static void UnloadPooledRenderTexture(PooledRenderTexture* pooled)
+{
+    RenderTexturePool.find_erase(pooled);
+    UnloadRenderTexture(pooled->Target);
+    IM_DELETE(pooled);
+    RenderTexturePoolStats.Unloads++;
+}
+
+static void TrimRenderTexturePool(unsigned int keepFrames)
+{
+    for (int i = RenderTexturePool.Size - 1; i >= 0; i--)
+    {
+        PooledRenderTexture* pooled = RenderTexturePool[i];
+        if (!pooled->InUse && RenderTexturePoolFrame - pooled->LastUsedFrame >= keepFrames)
+            UnloadPooledRenderTexture(pooled);
+    }
+}
+
+// frames are counted by the default context, like the image atlas
+static void EndRenderTexturePoolFrame(void)
+{
+    RenderTexturePoolFrame++;
+    TrimRenderTexturePool(unsigned(RenderTexturePoolKeepFrames));
+}
+
+static void DestroyRenderTexturePool(void)
+{
+    while (!RenderTexturePool.empty())
+        UnloadPooledRenderTexture(RenderTexturePool.back());
+}
+
+static bool GetRenderTextureContent(const RenderTexture* texture, int& width, int& height)
+{
+    const PooledRenderTexture* pooled = FindPooledRenderTexture(texture);
+    if (!pooled)
+        return false;
+
+    width = pooled->ContentWidth;
+    height = pooled->ContentHeight;
+    return true;
+}
+
+// draws into the content part of a pooled texture, the 2D projection can be bigger than the content to draw it scaled down
+static void BeginPooledTextureMode(PooledRenderTexture* pooled, int projectionWidth, int projectionHeight)
+{
+    BeginTextureMode(pooled->Target);
+    rlViewport(0, 0, pooled->ContentWidth, pooled->ContentHeight);
+
+    rlMatrixMode(RL_PROJECTION);
+    rlLoadIdentity();
+    rlOrtho(0, projectionWidth, projectionHeight, 0, 0.0f, 1.0f);
+    rlMatrixMode(RL_MODELVIEW);
+    rlLoadIdentity();
+
+    pooled->LastUsedFrame = RenderTexturePoolFrame;
+}
+
+void rlImGuiSetRenderTexturePoolLimits(int bucketSize, int keepFrames, int settleFrames)
+{
+    if (bucketSize > 0)
+        RenderTexturePoolBucket = bucketSize;
+    if (keepFrames > 0)
+        RenderTexturePoolKeepFrames = keepFrames;
+    if (settleFrames > 0)
+        RenderTexturePoolSettleFrames = settleFrames;
+}
+
+const RenderTexture* rlImGuiAcquireRenderTexture(int width, int height)
+{
+    if (width <= 0 || height <= 0)
+        return nullptr;
+
+    return &AcquirePooledRenderTexture(width, height)->Target;
+}
+
+void rlImGuiReleaseRenderTexture(const RenderTexture* texture)
+{
+    ReleasePooledRenderTexture(FindPooledRenderTexture(texture));
+}
+
+bool rlImGuiBeginRenderTextureMode(const RenderTexture* texture)
+{
+    PooledRenderTexture* pooled = FindPooledRenderTexture(texture);
+    if (!pooled)
+        return false;
+
+    BeginPooledTextureMode(pooled, pooled->ContentWidth, pooled->ContentHeight);
+    return true;
+}
+
+void rlImGuiTrimRenderTexturePool(void)
+{
+    TrimRenderTexturePool(0);
+}
+
+bool rlImGuiGetRenderTexturePoolStats(rlImGuiRenderTexturePoolStats* stats)
+{
+    if (!stats)
+        return false;
+
+    *stats = RenderTexturePoolStats;
+    stats->Textures = RenderTexturePool.Size;
+    stats->TexturesInUse = 0;
+    stats->TextureBytes = 0;
+    stats->BytesInUse = 0;
+
+    for (const PooledRenderTexture* pooled : RenderTexturePool)
+    {
+        long long bytes = GetRenderTextureBytes(pooled->Target);
+        stats->TextureBytes += bytes;
+        if (pooled->InUse)
+        {
+            stats->TexturesInUse++;
+            stats->BytesInUse += bytes;
+        }
+    }
+    return true;
+}
+
+// viewports
+static constexpr int ViewportFrameTimeCount = 120;
+
+// the scale goes down quickly when the frame is over budget, and only goes back up after a long time well under it,
+// so it does not flip between two scales. After a change the smoothed time is given time to catch up.
+static constexpr int ViewportOverBudgetFrames = 3;
+static constexpr int ViewportUnderBudgetFrames = 60;
+static constexpr float ViewportUnderBudget = 0.85f;
+static constexpr int ViewportScaleCooldown = 15;
+static constexpr float ViewportScaleDown = 0.85f;
+static constexpr float ViewportScaleUp = 1.05f;
+
+struct rlImGuiViewport
+{
+    PooledRenderTexture* Texture = nullptr;
+
+    // a new size has to stay the same for the settle frames before the texture is made to fit it
+    int RequestWidth = 0;
+    int RequestHeight = 0;
+    int StableFrames = 0;
+
+    ImGuiContext* Context = nullptr;    // the context the viewport was last visible in
+    int VisibleFrame = 0;               // the frame of that context it was last visible in
+    int PixelWidth = 0;
+    int PixelHeight = 0;
+    Rectangle ScreenRect = { 0 };
+
+    int ReleaseFrames = 120;
+
+    // dynamic resolution, the texture is drawn at the pixel size times the scale and shown at the full size
+    float TargetFrameMs = 0;
+    float MinScale = 0.5f;
+    float MaxScale = 1;
+    float Scale = 1;
+    float SmoothedFrameMs = 0;
+    int OverBudgetFrames = 0;
+    int UnderBudgetFrames = 0;
+    int ScaleCooldown = 0;
+
+    float FrameTimes[ViewportFrameTimeCount] = {};
+    int FrameTimeOffset = 0;
+    int FrameTimeCount = 0;
+};
+
+static ImVector<rlImGuiViewport*> Viewports;
+static rlImGuiViewportStats ViewportStats = {};
+
+// extra contexts can be destroyed while a viewport still points at them
+static bool IsLiveContext(ImGuiContext* context)
+{
+    if (context == nullptr)
+        return false;
+
+    if (context == GlobalContext)
+        return true;
+
+    for (const rlImGuiContext* extra : ExtraContexts)
+    {
+        if (extra->Context == context)
+            return true;
+    }
+    return false;
+}
+
+// frames since the viewport was visible, a viewport that never was is hidden forever
+static int GetViewportHiddenFrames(const rlImGuiViewport* viewport)
+{
+    if (!IsLiveContext(viewport->Context))
+        return std::numeric_limits<int>::max();
+
+    return viewport->Context->FrameCount - viewport->VisibleFrame;
+}
+
+static void ReleaseViewportTexture(rlImGuiViewport* viewport)
+{
+    ReleasePooledRenderTexture(viewport->Texture);
+    viewport->Texture = nullptr;
+}
+
+// dynamic resolution, the scale goes down while the frame time is over the target and back up once it is well under it
+static void UpdateViewportScale(rlImGuiViewport* viewport)
+{
+    float frameMs = GetFrameTime() * 1000.0f;
+
+    viewport->FrameTimes[viewport->FrameTimeOffset] = frameMs;
+    viewport->FrameTimeOffset = (viewport->FrameTimeOffset + 1) % ViewportFrameTimeCount;
+    viewport->FrameTimeCount = ImMin(viewport->FrameTimeCount + 1, ViewportFrameTimeCount);
+
+    if (viewport->TargetFrameMs <= 0)
+    {
+        viewport->Scale = 1;
+        return;
+    }
+
+    if (viewport->SmoothedFrameMs <= 0)
+        viewport->SmoothedFrameMs = frameMs;
+    viewport->SmoothedFrameMs += (frameMs - viewport->SmoothedFrameMs) * 0.1f;
+
+    if (viewport->ScaleCooldown > 0)
+    {
+        viewport->ScaleCooldown--;
+        return;
+    }
+
+    float scale = viewport->Scale;
+    if (viewport->SmoothedFrameMs > viewport->TargetFrameMs)
+    {
+        viewport->UnderBudgetFrames = 0;
+        if (++viewport->OverBudgetFrames >= ViewportOverBudgetFrames)
+            scale = ImMax(viewport->MinScale, scale * ViewportScaleDown);
+    }
+    else if (viewport->SmoothedFrameMs < viewport->TargetFrameMs * ViewportUnderBudget)
+    {
+        viewport->OverBudgetFrames = 0;
+        if (++viewport->UnderBudgetFrames >= ViewportUnderBudgetFrames)
+            scale = ImMin(viewport->MaxScale, scale * ViewportScaleUp);
+    }
+    else
+    {
+        viewport->OverBudgetFrames = 0;
+        viewport->UnderBudgetFrames = 0;
+    }
+
+    if (scale != viewport->Scale)
+    {
+        viewport->Scale = scale;
+        viewport->OverBudgetFrames = 0;
+        viewport->UnderBudgetFrames = 0;
+        viewport->ScaleCooldown = ViewportScaleCooldown;
+    }
+}
+
+static int GetViewportRenderWidth(const rlImGuiViewport* viewport)
+{
+    return ImMax(1, int(viewport->PixelWidth * viewport->Scale + 0.5f));
+}
+
+static int GetViewportRenderHeight(const rlImGuiViewport* viewport)
+{
+    return ImMax(1, int(viewport->PixelHeight * viewport->Scale + 0.5f));
+}
+
+// while the size changes the view draws into part of a bigger texture, once it settles the texture is made to fit
+static void UpdateViewportTexture(rlImGuiViewport* viewport)
+{
+    int width = GetViewportRenderWidth(viewport);
+    int height = GetViewportRenderHeight(viewport);
+
+    if (width != viewport->RequestWidth || height != viewport->RequestHeight)
+    {
+        viewport->RequestWidth = width;
+        viewport->RequestHeight = height;
+        viewport->StableFrames = 0;
+    }
+    else if (viewport->StableFrames < RenderTexturePoolSettleFrames)
+    {
+        viewport->StableFrames++;
+    }
+    bool settled = viewport->StableFrames >= RenderTexturePoolSettleFrames;
+
+    PooledRenderTexture* pooled = viewport->Texture;
+    if (pooled && pooled->Target.texture.width >= width && pooled->Target.texture.height >= height)
+    {
+        long long area = (long long)pooled->Target.texture.width * pooled->Target.texture.height;
+        long long fitted = (long long)RoundUpToBucket(width) * RoundUpToBucket(height);
+        if (!settled || area <= fitted * RenderTexturePoolWaste)
+        {
+            pooled->ContentWidth = width;
+            pooled->ContentHeight = height;
+            return;
+        }
+    }
+
+    // growing while the size still changes leaves room, so a drag does not make a texture every bucket
+    ReleaseViewportTexture(viewport);
+    if (settled)
+        viewport->Texture = AcquirePooledRenderTexture(width, height);
+    else
+        viewport->Texture = AcquirePooledRenderTexture(width + width / 4, height + height / 4);
+
+    viewport->Texture->ContentWidth = width;
+    viewport->Texture->ContentHeight = height;
+}
+
+rlImGuiViewport* rlImGuiCreateViewport(void)
+{
+    rlImGuiViewport* viewport = IM_NEW(rlImGuiViewport)();
+    Viewports.push_back(viewport);
+    return viewport;
+}
+
+void rlImGuiDestroyViewport(rlImGuiViewport* viewport)
+{
+    if (!viewport)
+        return;
+
+    Viewports.find_erase(viewport);
+    ReleaseViewportTexture(viewport);
+    IM_DELETE(viewport);
+}
+
+static void DestroyViewports(void)
+{
+    while (!Viewports.empty())
+        rlImGuiDestroyViewport(Viewports.back());
+}
+
+void rlImGuiSetViewportReleaseFrames(rlImGuiViewport* viewport, int frames)
+{
+    if (viewport)
+        viewport->ReleaseFrames = ImMax(0, frames);
+}
+
+bool rlImGuiViewportImage(rlImGuiViewport* viewport, Vector2 size)
+{
+    if (!viewport)
+        return false;
+
+    SetFrameContext();
+
+    // a collapsed window, or a dock tab that is not selected, skips its items
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImVec2 avail = ImGui::GetContentRegionAvail();
+    ImVec2 itemSize(size.x > 0 ? size.x : avail.x, size.y > 0 ? size.y : avail.y);
+    itemSize = ImVec2(ImFloor(ImMax(itemSize.x, 0.0f)), ImFloor(ImMax(itemSize.y, 0.0f)));
+
+    ImVec2 pos = ImGui::GetCursorScreenPos();
+    ImRect bb(pos, ImVec2(pos.x + itemSize.x, pos.y + itemSize.y));
+    ImGui::ItemSize(itemSize);
+
+    // scrolled out of the window
+    if (!ImGui::ItemAdd(bb, 0))
+        return false;
+
+    if (itemSize.x < 1 || itemSize.y < 1 || IsWindowMinimized())
+        return false;
+
+    ImVec2 scale = GetFramebufferScale();
+    viewport->Context = ImGui::GetCurrentContext();
+    viewport->VisibleFrame = ImGui::GetFrameCount();
+    viewport->PixelWidth = int(itemSize.x * scale.x + 0.5f);
+    viewport->PixelHeight = int(itemSize.y * scale.y + 0.5f);
+    viewport->ScreenRect = Rectangle{ bb.Min.x, bb.Min.y, itemSize.x, itemSize.y };
+
+    // the texture is from the last render, if the view was resized it is stretched until the next one
+    const PooledRenderTexture* pooled = viewport->Texture;
+    if (pooled)
+    {
+        ImVec2 uv0(0, pooled->ContentHeight / float(pooled->Target.texture.height));
+        ImVec2 uv1(pooled->ContentWidth / float(pooled->Target.texture.width), 0);
+        window->DrawList->AddImage(ImTextureID(pooled->Target.texture.id), bb.Min, bb.Max, uv0, uv1);
+    }
+
+    return true;
+}
+
+bool rlImGuiIsViewportVisible(const rlImGuiViewport* viewport)
+{
+    if (!viewport || !IsLiveContext(viewport->Context))
+        return false;
+
+    // between frames the last frame is the current frame count, while a frame of the context is being built it is one less
+    int lastFrame = viewport->Context->WithinFrameScope ? 1 : 0;
+    return GetViewportHiddenFrames(viewport) <= lastFrame;
+}
+
+Vector2 rlImGuiGetViewportPixelSize(const rlImGuiViewport* viewport)
+{
+    if (!viewport)
+        return Vector2{ 0, 0 };
+
+    return Vector2{ float(viewport->PixelWidth), float(viewport->PixelHeight) };
+}
+
+Rectangle rlImGuiGetViewportScreenRect(const rlImGuiViewport* viewport)
+{
+    if (!viewport)
+        return Rectangle{ 0 };
+
+    return viewport->ScreenRect;
+}
+
+bool rlImGuiBeginViewportTexture(rlImGuiViewport* viewport)
+{
+    if (!viewport)
+        return false;
+
+    if (!rlImGuiIsViewportVisible(viewport))
+    {
+        ViewportStats.SkippedRenders++;
+
+        // views that stay hidden give back their memory, they are drawn again the frame after they are shown
+        if (viewport->ReleaseFrames > 0 && GetViewportHiddenFrames(viewport) > viewport->ReleaseFrames)
+            ReleaseViewportTexture(viewport);
+        return false;
+    }
+
+    UpdateViewportScale(viewport);
+    UpdateViewportTexture(viewport);
+
+    // the 2D projection stays at the pixel size, so 2D drawing does not need to know about the scale
+    ViewportStats.Renders++;
+    BeginPooledTextureMode(viewport->Texture, viewport->PixelWidth, viewport->PixelHeight);
+    return true;
+}
+
+void rlImGuiEndViewportTexture(rlImGuiViewport* viewport)
+{
+    if (viewport)
+        EndTextureMode();
+}
+
+// BeginMode3D takes the aspect from the whole render texture, a view that draws into part of one needs its own
+static void BeginMode3DAspect(Camera3D camera, float aspect)
+{
+    rlDrawRenderBatchActive();
+
+    rlMatrixMode(RL_PROJECTION);
+    rlPushMatrix();
+    rlLoadIdentity();
+
+    if (camera.projection == CAMERA_PERSPECTIVE)
+    {
+        double top = RL_CULL_DISTANCE_NEAR * tan(camera.fovy * 0.5 * DEG2RAD);
+        double right = top * aspect;
+        rlFrustum(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+    else
+    {
+        double top = camera.fovy / 2.0;
+        double right = top * aspect;
+        rlOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+
+    rlMatrixMode(RL_MODELVIEW);
+    rlLoadIdentity();
+
+    // the same view matrix as MatrixLookAt, column major
+    Vector3 forward = { camera.position.x - camera.target.x, camera.position.y - camera.target.y, camera.position.z - camera.target.z };
+    float length = sqrtf(forward.x * forward.x + forward.y * forward.y + forward.z * forward.z);
+    if (length == 0)
+        length = 1;
+    Vector3 z = { forward.x / length, forward.y / length, forward.z / length };
+
+    Vector3 side = { camera.up.y * z.z - camera.up.z * z.y, camera.up.z * z.x - camera.up.x * z.z, camera.up.x * z.y - camera.up.y * z.x };
+    length = sqrtf(side.x * side.x + side.y * side.y + side.z * side.z);
+    if (length == 0)
+        length = 1;
+    Vector3 x = { side.x / length, side.y / length, side.z / length };
+
+    Vector3 y = { z.y * x.z - z.z * x.y, z.z * x.x - z.x * x.z, z.x * x.y - z.y * x.x };
+
+    Vector3 eye = camera.position;
+    float view[16] =
+    {
+        x.x, y.x, z.x, 0,
+        x.y, y.y, z.y, 0,
+        x.z, y.z, z.z, 0,
+        -(x.x * eye.x + x.y * eye.y + x.z * eye.z), -(y.x * eye.x + y.y * eye.y + y.z * eye.z), -(z.x * eye.x + z.y * eye.y + z.z * eye.z), 1,
+    };
+    rlMultMatrixf(view);
+
+    rlEnableDepthTest();
+}
+
+void rlImGuiBeginViewportMode3D(const rlImGuiViewport* viewport, Camera3D camera)
+{
+    if (!viewport || viewport->PixelWidth <= 0 || viewport->PixelHeight <= 0)
+    {
+        BeginMode3D(camera);
+        return;
+    }
+
+    BeginMode3DAspect(camera, viewport->PixelWidth / float(viewport->PixelHeight));
+}
+
+void rlImGuiSetViewportDynamicResolution(rlImGuiViewport* viewport, float targetFrameMs, float minScale, float maxScale)
+{
+    if (!viewport)
+        return;
+
+    targetFrameMs = ImMax(0.0f, targetFrameMs);
+    minScale = ImClamp(minScale, 0.1f, 1.0f);
+    maxScale = ImClamp(maxScale, minScale, 1.0f);
+
+    // it can be called every frame, the smoothed time is only started again when something changes
+    if (targetFrameMs == viewport->TargetFrameMs && minScale == viewport->MinScale && maxScale == viewport->MaxScale)
+        return;
+
+    viewport->TargetFrameMs = targetFrameMs;
+    viewport->MinScale = minScale;
+    viewport->MaxScale = maxScale;
+    viewport->Scale = ImClamp(viewport->Scale, viewport->MinScale, viewport->MaxScale);
+    viewport->SmoothedFrameMs = 0;
+    viewport->OverBudgetFrames = 0;
+    viewport->UnderBudgetFrames = 0;
+    viewport->ScaleCooldown = 0;
+}
+
+float rlImGuiGetViewportResolutionScale(const rlImGuiViewport* viewport)
+{
+    if (!viewport)
+        return 1;
+
+    return viewport->Scale;
+}
+
+Vector2 rlImGuiGetViewportRenderSize(const rlImGuiViewport* viewport)
+{
+    if (!viewport || viewport->PixelWidth <= 0 || viewport->PixelHeight <= 0)
+        return Vector2{ 0, 0 };
+
+    return Vector2{ float(GetViewportRenderWidth(viewport)), float(GetViewportRenderHeight(viewport)) };
+}
+
+const float* rlImGuiGetViewportFrameTimes(const rlImGuiViewport* viewport, int* count, int* offset)
+{
+    if (!viewport)
+        return nullptr;
+
+    // until the history is full it starts at 0, after that the oldest time is at the offset
+    if (count)
+        *count = viewport->FrameTimeCount;
+    if (offset)
+        *offset = viewport->FrameTimeCount < ViewportFrameTimeCount ? 0 : viewport->FrameTimeOffset;
+    return viewport->FrameTimes;
+}
+
+const RenderTexture* rlImGuiGetViewportTexture(const rlImGuiViewport* viewport)
+{
+    if (!viewport || !viewport->Texture)
+        return nullptr;
+
+    return &viewport->Texture->Target;
+}
+
+bool rlImGuiGetViewportStats(rlImGuiViewportStats* stats)
+{
+    if (!stats)
+        return false;
+
+    *stats = ViewportStats;
+    stats->Viewports = Viewports.Size;
+    stats->VisibleViewports = 0;
+    stats->Textures = 0;
+    stats->TextureBytes = 0;
+
+    for (const rlImGuiViewport* viewport : Viewports)
+    {
+        if (rlImGuiIsViewportVisible(viewport))
+            stats->VisibleViewports++;
+
+        if (viewport->Texture)
+        {
+            stats->Textures++;
+            stats->TextureBytes += GetRenderTextureBytes(viewport->Texture->Target);
+        }
+    }
+    return true;
+}
+
+// scenes
+// a scene is a draw callback in the window draw list, it is drawn straight into the framebuffer between the ImGui
+// commands before and after it, so windows on top of it cover it
+struct SceneCommand
+{
+    rlImGuiSceneCallback Draw = nullptr;
+    void* UserData = nullptr;
+    ImVec2 Min;
+    ImVec2 Max;
+};
+
+static float SceneAspect = 0;
+
+static void SceneDrawCallback(const ImDrawList*, const ImDrawCmd* cmd)
+{
+    const SceneCommand& scene = *static_cast<const SceneCommand*>(cmd->UserCallbackData);
+
+    float x = scene.Min.x - RenderDisplayPos.x;
+    float y = scene.Min.y - RenderDisplayPos.y;
+    float width = scene.Max.x - scene.Min.x;
+    float height = scene.Max.y - scene.Min.y;
+
+    double start = GetTime();
+
+    // the GL viewport moves the origin to the scene, and the scissor is cut down to the part of the scene inside the
+    // clip rect, glClear only follows the scissor so ClearBackground would wipe the rest of the window otherwise
+    rlDrawRenderBatchActive();
+    float clipMinX = ImMax(cmd->ClipRect.x, scene.Min.x) - RenderDisplayPos.x;
+    float clipMinY = ImMax(cmd->ClipRect.y, scene.Min.y) - RenderDisplayPos.y;
+    float clipMaxX = ImMin(cmd->ClipRect.z, scene.Max.x) - RenderDisplayPos.x;
+    float clipMaxY = ImMin(cmd->ClipRect.w, scene.Max.y) - RenderDisplayPos.y;
+    if (clipMaxX <= clipMinX || clipMaxY <= clipMinY)
+        return;
+    EnableScissor(clipMinX, clipMinY, clipMaxX - clipMinX, clipMaxY - clipMinY);
+
+    ImVec2 scale = GetFramebufferScale();
+    rlViewport(int(x * scale.x), int((RenderDisplaySize.y - (y + height)) * scale.y), int(width * scale.x), int(height * scale.y));
+
+    rlMatrixMode(RL_PROJECTION);
+    rlPushMatrix();
+    rlLoadIdentity();
+    rlOrtho(0, width, height, 0, 0.0f, 1.0f);
+    rlMatrixMode(RL_MODELVIEW);
+    rlPushMatrix();
+    rlLoadIdentity();
+
+    SceneAspect = width / height;
+    scene.Draw(Vector2{ width, height }, scene.UserData);
+    SceneAspect = 0;
+
+    // back to the state ImGui draws with
+    rlDrawRenderBatchActive();
+    rlMatrixMode(RL_PROJECTION);
+    rlPopMatrix();
+    rlMatrixMode(RL_MODELVIEW);
+    rlPopMatrix();
+    rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
+    EnableScissor(cmd->ClipRect.x - RenderDisplayPos.x, cmd->ClipRect.y - RenderDisplayPos.y, cmd->ClipRect.z - cmd->ClipRect.x, cmd->ClipRect.w - cmd->ClipRect.y);
+    rlDisableDepthTest();
+    rlDisableBackfaceCulling();
+    rlSetTexture(0);
+
+    SceneStats.Scenes++;
+    SceneStats.DrawMs += float((GetTime() - start) * 1000.0);
+}
+
+bool rlImGuiScene(Vector2 size, rlImGuiSceneCallback draw, void* userData)
+{
+    if (!draw)
+        return false;
+
+    SetFrameContext();
+
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImVec2 avail = ImGui::GetContentRegionAvail();
+    ImVec2 itemSize(size.x > 0 ? size.x : avail.x, size.y > 0 ? size.y : avail.y);
+    itemSize = ImVec2(ImFloor(ImMax(itemSize.x, 0.0f)), ImFloor(ImMax(itemSize.y, 0.0f)));
+
+    ImVec2 pos = ImGui::GetCursorScreenPos();
+    ImRect bb(pos, ImVec2(pos.x + itemSize.x, pos.y + itemSize.y));
+    ImGui::ItemSize(itemSize);
+
+    // scrolled out of the window, the scene is not drawn at all
+    if (!ImGui::ItemAdd(bb, 0) || itemSize.x < 1 || itemSize.y < 1)
+        return false;
+
+    SceneCommand scene;
+    scene.Draw = draw;
+    scene.UserData = userData;
+    scene.Min = bb.Min;
+    scene.Max = bb.Max;
+    window->DrawList->AddCallback(SceneDrawCallback, &scene, sizeof(scene));
+    return true;
+}
+
+void rlImGuiBeginSceneMode3D(Camera3D camera)
+{
+    if (SceneAspect <= 0)
+    {
+        BeginMode3D(camera);
+        return;
+    }
+
+    BeginMode3DAspect(camera, SceneAspect);
+}
+
+bool rlImGuiGetSceneStats(rlImGuiSceneStats* stats)
+{
+    if (!stats)
+        return false;
+
+    *stats = SceneStats;
+    return true;
+}
+
+// large images
+// A large image is drawn from the tiles of a mip pyramid, and only the tiles in view at the level that matches the zoom are
+// loaded. Tiles are read and decoded on worker threads, uploaded on the main thread a few each frame, and kept in a cache
+// that unloads the tiles drawn longest ago when the tile textures are over the memory budget.
+static constexpr int LargeImageTileSize = 256;
+static constexpr int LargeImageWorkerCount = 2;
+
+// the tiled file is a header, the position and size of every tile from level 0 up, then the tiles as PNG files
+static constexpr char LargeImageMagic[4] = { 'R', 'I', 'L', 'I' };
+static constexpr unsigned int LargeImageVersion = 1;
+
+struct LargeImageFileHeader
+{
+    char Magic[4];
+    unsigned int Version;
+    int Width;
+    int Height;
+    int TileSize;
+    int Levels;
+};
+
+struct LargeImageFileTile
+{
+    long long Offset;
+    long long Size;
+};
+
+enum LargeImageTileState
+{
+    LargeImageTile_Queued,      // waiting for a worker
+    LargeImageTile_Loading,     // a worker is loading the pixels
+    LargeImageTile_Loaded,      // the pixels are waiting to be uploaded
+    LargeImageTile_Ready,       // the texture is loaded
+    LargeImageTile_Failed,
+    LargeImageTile_Cancelled,   // taken out of the queue before a worker got to it
+};
+
+struct LargeImageTile
+{
+    rlImGuiLargeImage* Owner = nullptr;
+    int Level = 0;
+    int Column = 0;
+    int Row = 0;
+    int Width = 0;
+    int Height = 0;
+    std::atomic<int> State{ LargeImageTile_Queued };
+    unsigned char* Pixels = nullptr;    // set by the worker before the state is Loaded
+    float LoadMs = 0;
+    Texture2D Texture = { 0 };
+    unsigned int LastUsedFrame = 0;
+};
+
+struct rlImGuiLargeImage
+{
+    int Width = 0;
+    int Height = 0;
+    int Levels = 0;
+    ImVector<int> LevelColumns;
+    ImVector<int> LevelRows;
+    ImVector<int> LevelFirstTile;
+    ImVector<LargeImageTile*> Tiles;    // every tile of every level, null until it is asked for
+
+    rlImGuiLargeImageLoader Loader = nullptr;
+    void* UserData = nullptr;
+
+    FILE* File = nullptr;
+    ImVector<LargeImageFileTile> FileTiles;
+#if !defined(RLIMGUI_NO_THREADS)
+    std::mutex FileMutex;
+#endif
+    std::atomic<int> Loading{ 0 };      // tiles a worker is loading right now
+
+    // the view, the image pixel at the center and screen pixels per image pixel
+    Vector2 Center = { 0, 0 };
+    float Zoom = 0;
+    float TargetZoom = 0;
+    ImVec2 ZoomAnchor;                  // the screen point that stays still while the zoom eases to the target
+};
+
+static ImVector<rlImGuiLargeImage*> LargeImages;
+static ImVector<LargeImageTile*> LargeImageQueue;           // guarded by the queue lock, the back is loaded first
+static ImVector<LargeImageTile*> LargeImageTilesInFlight;   // tiles that are queued, loading or waiting to be uploaded
+static ImVector<LargeImageTile*> LargeImageCache;           // tiles with a texture, or that failed to load
+static ImVector<LargeImageTile*> LargeImageRequests;
+static long long LargeImageBudget = 256ll * 1024 * 1024;
+static int LargeImageUploadsPerFrame = 8;
+static long long LargeImageBytes = 0;
+static unsigned int LargeImageFrame = 0;
+static rlImGuiLargeImageStats LargeImageStats = {};
+static int LargeImageTilesDrawn = 0;
+static int LargeImageFallbackTiles = 0;
+static double LargeImageLoadMs = 0;
+
+#if !defined(RLIMGUI_NO_THREADS)
+static std::mutex LargeImageMutex;
+static std::condition_variable LargeImageWake;
+static std::thread LargeImageWorkers[LargeImageWorkerCount];
+static bool LargeImageWorkersRunning = false;
+static bool LargeImageQuit = false;
+#endif
+
+// holds the queue lock for a scope, there is nothing to lock without threads
+struct LargeImageQueueLock
+{
+#if !defined(RLIMGUI_NO_THREADS)
+    std::lock_guard<std::mutex> Guard{ LargeImageMutex };
+#else
+    LargeImageQueueLock() {}
+#endif
+};
+
+static bool SeekLargeImageFile(FILE* file, long long offset)
+{
+#if defined(_WIN32)
+    return _fseeki64(file, offset, SEEK_SET) == 0;
+#else
+    return fseeko(file, off_t(offset), SEEK_SET) == 0;
+#endif
+}
+
+static long long TellLargeImageFile(FILE* file)
+{
+#if defined(_WIN32)
+    return _ftelli64(file);
+#else
+    return (long long)ftello(file);
+#endif
+}
+
+static int GetLargeImageLevelSize(int size, int level)
+{
+    return ImMax(1, (size + (1 << level) - 1) >> level);
+}
+
+// the levels go down by half until the whole image fits in one tile, returns the number of tiles in all of them
+static int SetupLargeImageLevels(rlImGuiLargeImage* image, int width, int height)
+{
+    image->Width = width;
+    image->Height = height;
+    image->Levels = 1;
+    while (GetLargeImageLevelSize(width, image->Levels - 1) > LargeImageTileSize || GetLargeImageLevelSize(height, image->Levels - 1) > LargeImageTileSize)
+        image->Levels++;
+
+    int tiles = 0;
+    for (int level = 0; level < image->Levels; level++)
+    {
+        int columns = (GetLargeImageLevelSize(width, level) + LargeImageTileSize - 1) / LargeImageTileSize;
+        int rows = (GetLargeImageLevelSize(height, level) + LargeImageTileSize - 1) / LargeImageTileSize;
+        image->LevelColumns.push_back(columns);
+        image->LevelRows.push_back(rows);
+        image->LevelFirstTile.push_back(tiles);
+        tiles += columns * rows;
+    }
+    return tiles;
+}
+
+static int GetLargeImageTileIndex(const rlImGuiLargeImage* image, int level, int column, int row)
+{
+    return image->LevelFirstTile[level] + row * image->LevelColumns[level] + column;
+}
+
+// tiles on the right and bottom edges are smaller than the tile size
+static int GetLargeImageTileWidth(const rlImGuiLargeImage* image, int level, int column)
+{
+    return ImMin(LargeImageTileSize, GetLargeImageLevelSize(image->Width, level) - column * LargeImageTileSize);
+}
+
+static int GetLargeImageTileHeight(const rlImGuiLargeImage* image, int level, int row)
+{
+    return ImMin(LargeImageTileSize, GetLargeImageLevelSize(image->Height, level) - row * LargeImageTileSize);
+}
+
+static bool DecodeLargeImageFileTile(const LargeImageTile* tile, unsigned char* pixels)
+{
+    rlImGuiLargeImage* image = tile->Owner;
+    const LargeImageFileTile& entry = image->FileTiles[GetLargeImageTileIndex(image, tile->Level, tile->Column, tile->Row)];
+    if (entry.Size <= 0 || entry.Size > std::numeric_limits<int>::max())
+        return false;
+
+    unsigned char* data = (unsigned char*)MemAlloc((unsigned int)entry.Size);
+    bool read = false;
+    {
+#if !defined(RLIMGUI_NO_THREADS)
+        std::lock_guard<std::mutex> lock(image->FileMutex);
+#endif
+        read = SeekLargeImageFile(image->File, entry.Offset) && fread(data, 1, size_t(entry.Size), image->File) == size_t(entry.Size);
+    }
+
+    // only the file read is locked, the workers decode at the same time
+    Image decoded = read ? LoadImageFromMemory(".png", data, int(entry.Size)) : Image{ 0 };
+    MemFree(data);
+
+    bool valid = decoded.data && decoded.width == tile->Width && decoded.height == tile->Height;
+    if (valid)
+    {
+        ImageFormat(&decoded, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        memcpy(pixels, decoded.data, size_t(tile->Width) * tile->Height * 4);
+    }
+
+    UnloadImage(decoded);
+    return valid;
+}
+
+// runs on a worker thread, or on the main thread without threads
+static void LoadLargeImageTile(LargeImageTile* tile)
+{
+    double start = GetTime();
+    rlImGuiLargeImage* image = tile->Owner;
+
+    unsigned char* pixels = (unsigned char*)MemAlloc(unsigned(tile->Width * tile->Height * 4));
+    bool loaded = false;
+    if (image->File)
+        loaded = DecodeLargeImageFileTile(tile, pixels);
+    else
+        loaded = image->Loader(tile->Level, tile->Column * LargeImageTileSize, tile->Row * LargeImageTileSize, tile->Width, tile->Height, pixels, image->UserData);
+
+    if (!loaded)
+    {
+        MemFree(pixels);
+        pixels = nullptr;
+    }
+
+    tile->Pixels = pixels;
+    tile->LoadMs = float((GetTime() - start) * 1000.0);
+    tile->State.store(loaded ? LargeImageTile_Loaded : LargeImageTile_Failed, std::memory_order_release);
+}
+
+// the queue lock must be held
+static LargeImageTile* TakeLargeImageJob(void)
+{
+    LargeImageTile* tile = LargeImageQueue.back();
+    LargeImageQueue.pop_back();
+    tile->State.store(LargeImageTile_Loading, std::memory_order_relaxed);
+    tile->Owner->Loading.fetch_add(1, std::memory_order_relaxed);
+    return tile;
+}
+
+#if !defined(RLIMGUI_NO_THREADS)
+static void LargeImageWorker(void)
+{
+    std::unique_lock<std::mutex> lock(LargeImageMutex);
+    for (;;)
+    {
+        LargeImageWake.wait(lock, [] { return LargeImageQuit || !LargeImageQueue.empty(); });
+        if (LargeImageQuit)
+            return;
+
+        LargeImageTile* tile = TakeLargeImageJob();
+        lock.unlock();
+
+        // the tile can be uploaded and unloaded as soon as it is loaded, but the image lives until Loading is back to 0
+        rlImGuiLargeImage* owner = tile->Owner;
+        LoadLargeImageTile(tile);
+        owner->Loading.fetch_sub(1, std::memory_order_release);
+
+        lock.lock();
+    }
+}
+#endif
+
+static void StartLargeImageWorkers(void)
+{
+#if !defined(RLIMGUI_NO_THREADS)
+    if (LargeImageWorkersRunning)
+        return;
+
+    LargeImageQuit = false;
+    for (std::thread& worker : LargeImageWorkers)
+        worker = std::thread(LargeImageWorker);
+    LargeImageWorkersRunning = true;
+#endif
+}
+
+static void StopLargeImageWorkers(void)
+{
+#if !defined(RLIMGUI_NO_THREADS)
+    if (!LargeImageWorkersRunning)
+        return;
+
+    {
+        LargeImageQueueLock lock;
+        LargeImageQuit = true;
+    }
+    LargeImageWake.notify_all();
+
+    for (std::thread& worker : LargeImageWorkers)
+        worker.join();
+    LargeImageWorkersRunning = false;
+#endif
+}
+
+static long long GetLargeImageTileBytes(const LargeImageTile* tile)
+{
+    return (long long)tile->Width * tile->Height * 4;
+}
+
+static void FreeLargeImageTile(LargeImageTile* tile)
+{
+    rlImGuiLargeImage* image = tile->Owner;
+    image->Tiles[GetLargeImageTileIndex(image, tile->Level, tile->Column, tile->Row)] = nullptr;
+
+    if (tile->Texture.id != 0)
+    {
+        UnloadTexture(tile->Texture);
+        LargeImageBytes -= GetLargeImageTileBytes(tile);
+    }
+
+    MemFree(tile->Pixels);
+    IM_DELETE(tile);
+}
+
+static void UploadLargeImageTile(LargeImageTile* tile)
+{
+    Image pixels = { tile->Pixels, tile->Width, tile->Height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    tile->Texture = LoadTextureFromImage(pixels);
+    SetTextureFilter(tile->Texture, TEXTURE_FILTER_BILINEAR);
+    SetTextureWrap(tile->Texture, TEXTURE_WRAP_CLAMP);
+
+    MemFree(tile->Pixels);
+    tile->Pixels = nullptr;
+    tile->State.store(LargeImageTile_Ready, std::memory_order_relaxed);
+
+    LargeImageBytes += GetLargeImageTileBytes(tile);
+    LargeImageStats.Loads++;
+    LargeImageLoadMs += tile->LoadMs;
+}
+
+// gets a tile to draw, and asks for it to be loaded if it was not asked for yet
+static LargeImageTile* RequestLargeImageTile(rlImGuiLargeImage* image, int level, int column, int row)
+{
+    LargeImageTile*& tile = image->Tiles[GetLargeImageTileIndex(image, level, column, row)];
+    if (!tile)
+    {
+        tile = IM_NEW(LargeImageTile)();
+        tile->Owner = image;
+        tile->Level = level;
+        tile->Column = column;
+        tile->Row = row;
+        tile->Width = GetLargeImageTileWidth(image, level, column);
+        tile->Height = GetLargeImageTileHeight(image, level, row);
+        LargeImageRequests.push_back(tile);
+    }
+
+    tile->LastUsedFrame = LargeImageFrame;
+    return tile->State.load(std::memory_order_relaxed) == LargeImageTile_Ready ? tile : nullptr;
+}
+
+// the requests are in order of priority, the last one is loaded first
+static void QueueLargeImageRequests(void)
+{
+    if (LargeImageRequests.empty())
+        return;
+
+    {
+        LargeImageQueueLock lock;
+        for (LargeImageTile* tile : LargeImageRequests)
+            LargeImageQueue.push_back(tile);
+    }
+
+    for (LargeImageTile* tile : LargeImageRequests)
+        LargeImageTilesInFlight.push_back(tile);
+    LargeImageRequests.resize(0);
+
+#if !defined(RLIMGUI_NO_THREADS)
+    LargeImageWake.notify_all();
+#endif
+}
+
+// the tiles drawn longest ago are unloaded first, tiles drawn this frame are kept even when that is over the budget
+static void EvictLargeImageTiles(long long budget)
+{
+    if (LargeImageBytes <= budget)
+        return;
+
+    std::sort(LargeImageCache.begin(), LargeImageCache.end(), [](const LargeImageTile* a, const LargeImageTile* b) { return a->LastUsedFrame < b->LastUsedFrame; });
+
+    int evicted = 0;
+    while (evicted < LargeImageCache.Size && LargeImageBytes > budget && LargeImageCache[evicted]->LastUsedFrame != LargeImageFrame)
+    {
+        FreeLargeImageTile(LargeImageCache[evicted]);
+        evicted++;
+    }
+
+    LargeImageCache.erase(LargeImageCache.begin(), LargeImageCache.begin() + evicted);
+    LargeImageStats.Evictions += unsigned(evicted);
+}
+
+// frames are counted by the default context, like the render texture pool
+static void EndLargeImageFrame(void)
+{
+    if (!LargeImageTilesInFlight.empty())
+    {
+        // tiles that left the view before a worker got to them are not loaded
         {
-            Image img = { 0 };
-            img.width = tex->Width;
-            img.height = tex->Height;
+            LargeImageQueueLock lock;
+            int kept = 0;
+            for (LargeImageTile* tile : LargeImageQueue)
+            {
+                if (tile->LastUsedFrame == LargeImageFrame)
+                    LargeImageQueue[kept++] = tile;
+                else
+                    tile->State.store(LargeImageTile_Cancelled, std::memory_order_relaxed);
+            }
+            LargeImageQueue.resize(kept);
+        }
 
-            img.format = tex->Format == ImTextureFormat_Alpha8 ? PIXELFORMAT_UNCOMPRESSED_GRAYSCALE : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-            img.mipmaps = 1;
-            img.data = tex->GetPixels();
+#if defined(RLIMGUI_NO_THREADS)
+        // without threads the tiles are loaded here, as many as can be uploaded this frame
+        for (int i = 0; i < LargeImageUploadsPerFrame && !LargeImageQueue.empty(); i++)
+        {
+            LargeImageTile* tile = TakeLargeImageJob();
+            LoadLargeImageTile(tile);
+            tile->Owner->Loading.fetch_sub(1, std::memory_order_relaxed);
+        }
+#endif
 
-            Texture* texture = (Texture*)MemAlloc(sizeof(Texture));
-            tex->BackendUserData = texture;;
-            *texture = LoadTextureFromImage(img);
-            tex->SetTexID(ImTextureID(texture->id));
-            tex->Status = ImTextureStatus_OK;
+        int uploads = 0;
+        for (int i = 0; i < LargeImageTilesInFlight.Size;)
+        {
+            LargeImageTile* tile = LargeImageTilesInFlight[i];
+            int state = tile->State.load(std::memory_order_acquire);
+            if (state == LargeImageTile_Queued || state == LargeImageTile_Loading || (state == LargeImageTile_Loaded && uploads >= LargeImageUploadsPerFrame))
+            {
+                i++;
+                continue;
+            }
+
+            if (state == LargeImageTile_Cancelled)
+            {
+                FreeLargeImageTile(tile);
+                LargeImageStats.Cancels++;
+            }
+            else
+            {
+                // a tile that failed stays in the cache so it is not asked for again every frame
+                if (state == LargeImageTile_Loaded)
+                {
+                    UploadLargeImageTile(tile);
+                    uploads++;
+                }
+                else
+                {
+                    TraceLog(LOG_WARNING, "RLIMGUI: Could not load large image tile %d,%d of level %d", tile->Column, tile->Row, tile->Level);
+                }
+                LargeImageCache.push_back(tile);
+            }
+
+            LargeImageTilesInFlight[i] = LargeImageTilesInFlight.back();
+            LargeImageTilesInFlight.pop_back();
         }
-            break;
+    }
+
+    EvictLargeImageTiles(LargeImageBudget);
+
+    LargeImageStats.TilesDrawn = LargeImageTilesDrawn;
+    LargeImageStats.FallbackTiles = LargeImageFallbackTiles;
+    LargeImageTilesDrawn = 0;
+    LargeImageFallbackTiles = 0;
+    LargeImageFrame++;
+}
+
+static rlImGuiLargeImage* CreateLargeImage(int width, int height)
+{
+    rlImGuiLargeImage* image = IM_NEW(rlImGuiLargeImage)();
+    image->Tiles.resize(SetupLargeImageLevels(image, width, height), nullptr);
+    LargeImages.push_back(image);
+    StartLargeImageWorkers();
+    return image;
+}
+
+rlImGuiLargeImage* rlImGuiCreateLargeImage(int width, int height, rlImGuiLargeImageLoader loader, void* userData)
+{
+    if (width <= 0 || height <= 0 || !loader)
+        return nullptr;
+
+    rlImGuiLargeImage* image = CreateLargeImage(width, height);
+    image->Loader = loader;
+    image->UserData = userData;
+    return image;
+}
+
+rlImGuiLargeImage* rlImGuiLoadLargeImage(const char* fileName)
+{
+    if (!fileName)
+        return nullptr;
+
+    FILE* file = fopen(fileName, "rb");
+    if (!file)
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Could not open large image file", fileName);
+        return nullptr;
+    }
+
+    LargeImageFileHeader header = { 0 };
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.Magic, LargeImageMagic, sizeof(header.Magic)) == 0
+        && header.Version == LargeImageVersion && header.TileSize == LargeImageTileSize && header.Width > 0 && header.Height > 0;
+
+    rlImGuiLargeImage* image = valid ? CreateLargeImage(header.Width, header.Height) : nullptr;
+    if (image)
+    {
+        image->FileTiles.resize(image->Tiles.Size);
+        valid = header.Levels == image->Levels
+            && fread(image->FileTiles.Data, sizeof(LargeImageFileTile), size_t(image->FileTiles.Size), file) == size_t(image->FileTiles.Size);
+    }
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Invalid large image file", fileName);
+        rlImGuiDestroyLargeImage(image);
+        fclose(file);
+        return nullptr;
+    }
+
+    image->File = file;
+    return image;
+}
+
+void rlImGuiDestroyLargeImage(rlImGuiLargeImage* image)
+{
+    if (!image)
+        return;
+
+    {
+        LargeImageQueueLock lock;
+        int kept = 0;
+        for (LargeImageTile* tile : LargeImageQueue)
+        {
+            if (tile->Owner != image)
+                LargeImageQueue[kept++] = tile;
+        }
+        LargeImageQueue.resize(kept);
+    }
+
+#if !defined(RLIMGUI_NO_THREADS)
+    // a worker can still be loading one of its tiles
+    while (image->Loading.load(std::memory_order_acquire) > 0)
+        std::this_thread::yield();
+#endif
+
+    for (ImVector<LargeImageTile*>* list : { &LargeImageTilesInFlight, &LargeImageCache })
+    {
+        int kept = 0;
+        for (LargeImageTile* tile : *list)
+        {
+            if (tile->Owner != image)
+                (*list)[kept++] = tile;
+        }
+        list->resize(kept);
+    }
+
+    for (LargeImageTile* tile : image->Tiles)
+    {
+        if (tile)
+            FreeLargeImageTile(tile);
+    }
+
+    if (image->File)
+        fclose(image->File);
+
+    LargeImages.find_erase(image);
+    IM_DELETE(image);
+}
 
-        case ImTextureStatus_WantUpdates:
-        {
-            Texture* texture = (Texture*)tex->BackendUserData;
-            if (!texture)
-                break;
+static void DestroyLargeImages(void)
+{
+    while (!LargeImages.empty())
+        rlImGuiDestroyLargeImage(LargeImages.back());
 
-            UpdateTexture(*texture, tex->GetPixels());
+    StopLargeImageWorkers();
+}
 
-            tex->Status = ImTextureStatus_OK;
+// halves a tile into a quarter of the tile above it, each pixel is the average of the 2x2 pixels under it
+static void DownsampleLargeImageTile(const unsigned char* source, int sourceWidth, int sourceHeight, unsigned char* dest, int destWidth, int destHeight, int destX, int destY)
+{
+    int width = ImMin((sourceWidth + 1) / 2, destWidth - destX);
+    int height = ImMin((sourceHeight + 1) / 2, destHeight - destY);
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char* row0 = source + size_t(y * 2) * sourceWidth * 4;
+        const unsigned char* row1 = source + size_t(ImMin(y * 2 + 1, sourceHeight - 1)) * sourceWidth * 4;
+        unsigned char* out = dest + (size_t(destY + y) * destWidth + destX) * 4;
+
+        for (int x = 0; x < width; x++)
+        {
+            int x0 = x * 2 * 4;
+            int x1 = ImMin(x * 2 + 1, sourceWidth - 1) * 4;
+            for (int c = 0; c < 4; c++)
+                out[x * 4 + c] = (unsigned char)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) / 4);
         }
-            break;
+    }
+}
 
-        case ImTextureStatus_WantDestroy:
+// a tile comes from the loader at level 0 and from the four tiles under it above that, it is written after them
+static bool ExportLargeImageTile(rlImGuiLargeImage& layout, FILE* file, rlImGuiLargeImageLoader loader, void* userData, int level, int column, int row, unsigned char* pixels)
+{
+    int width = GetLargeImageTileWidth(&layout, level, column);
+    int height = GetLargeImageTileHeight(&layout, level, row);
+
+    if (level == 0)
+    {
+        if (!loader(0, column * LargeImageTileSize, row * LargeImageTileSize, width, height, pixels, userData))
+            return false;
+    }
+    else
+    {
+        unsigned char* child = (unsigned char*)MemAlloc(LargeImageTileSize * LargeImageTileSize * 4);
+        bool built = true;
+        for (int y = 0; y < 2 && built; y++)
         {
-            Texture* texture = (Texture*)tex->BackendUserData;
+            for (int x = 0; x < 2 && built; x++)
+            {
+                int childColumn = column * 2 + x;
+                int childRow = row * 2 + y;
+                if (childColumn >= layout.LevelColumns[level - 1] || childRow >= layout.LevelRows[level - 1])
+                    continue;
 
-            if (!texture)
-                break;
-            UnloadTexture(*texture);
-            tex->Status = ImTextureStatus_Destroyed;
-            MemFree(texture);
-            tex->BackendUserData = nullptr;
-            tex->SetTexID(ImTextureID_Invalid);
+                built = ExportLargeImageTile(layout, file, loader, userData, level - 1, childColumn, childRow, child);
+                if (built)
+                {
+                    DownsampleLargeImageTile(child, GetLargeImageTileWidth(&layout, level - 1, childColumn), GetLargeImageTileHeight(&layout, level - 1, childRow),
+                        pixels, width, height, x * LargeImageTileSize / 2, y * LargeImageTileSize / 2);
+                }
+            }
         }
-        break;
+        MemFree(child);
+
+        if (!built)
+            return false;
     }
+
+    Image image = { pixels, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    int size = 0;
+    unsigned char* png = ExportImageToMemory(image, ".png", &size);
+
+    LargeImageFileTile& entry = layout.FileTiles[GetLargeImageTileIndex(&layout, level, column, row)];
+    entry.Offset = TellLargeImageFile(file);
+    entry.Size = size;
+
+    bool written = png && fwrite(png, 1, size_t(size), file) == size_t(size);
+    MemFree(png);
+    return written;
 }
 
-void ImGui_ImplRaylib_RenderDrawData(ImDrawData* draw_data)
+bool rlImGuiExportLargeImage(const char* fileName, int width, int height, rlImGuiLargeImageLoader loader, void* userData)
 {
-    if (draw_data->Textures != nullptr)
+    if (!fileName || !loader || width <= 0 || height <= 0)
+        return false;
+
+    FILE* file = fopen(fileName, "wb");
+    if (!file)
     {
-        for (ImTextureData* tex : *draw_data->Textures)
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Could not write large image file", fileName);
+        return false;
+    }
+
+    rlImGuiLargeImage layout;
+    int tileCount = SetupLargeImageLevels(&layout, width, height);
+    layout.FileTiles.resize(tileCount);
+    memset(layout.FileTiles.Data, 0, size_t(tileCount) * sizeof(LargeImageFileTile));
+
+    LargeImageFileHeader header = { 0 };
+    memcpy(header.Magic, LargeImageMagic, sizeof(header.Magic));
+    header.Version = LargeImageVersion;
+    header.Width = width;
+    header.Height = height;
+    header.TileSize = LargeImageTileSize;
+    header.Levels = layout.Levels;
+
+    // the index is written again once the tiles are in the file
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(layout.FileTiles.Data, sizeof(LargeImageFileTile), size_t(tileCount), file) == size_t(tileCount);
+
+    // the top level is a single tile, building it builds every tile under it
+    unsigned char* pixels = (unsigned char*)MemAlloc(LargeImageTileSize * LargeImageTileSize * 4);
+    written = written && ExportLargeImageTile(layout, file, loader, userData, layout.Levels - 1, 0, 0, pixels);
+    MemFree(pixels);
+
+    written = written && SeekLargeImageFile(file, sizeof(header))
+        && fwrite(layout.FileTiles.Data, sizeof(LargeImageFileTile), size_t(tileCount), file) == size_t(tileCount);
+    written = fclose(file) == 0 && written;
+
+    if (!written)
+        TraceLog(LOG_WARNING, "RLIMGUI: [%s] Could not write large image file", fileName);
+    return written;
+}
+
+static void FitLargeImage(rlImGuiLargeImage* image, const ImVec2& size)
+{
+    image->Center = Vector2{ image->Width * 0.5f, image->Height * 0.5f };
+    image->Zoom = ImMin(size.x / image->Width, size.y / image->Height);
+    image->TargetZoom = image->Zoom;
+}
+
+// draws part of the image, in image pixels, from a tile of any level
+static void DrawLargeImageTile(const rlImGuiLargeImage* image, ImDrawList* drawList, const ImVec2& origin, const LargeImageTile* tile, float x0, float y0, float x1, float y1)
+{
+    float texel = float(1 << tile->Level);
+    float tileX = tile->Column * LargeImageTileSize * texel;
+    float tileY = tile->Row * LargeImageTileSize * texel;
+    float tileWidth = tile->Width * texel;
+    float tileHeight = tile->Height * texel;
+
+    ImVec2 uv0((x0 - tileX) / tileWidth, (y0 - tileY) / tileHeight);
+    ImVec2 uv1((x1 - tileX) / tileWidth, (y1 - tileY) / tileHeight);
+    ImVec2 p0(origin.x + x0 * image->Zoom, origin.y + y0 * image->Zoom);
+    ImVec2 p1(origin.x + x1 * image->Zoom, origin.y + y1 * image->Zoom);
+    drawList->AddImage(ImTextureID(tile->Texture.id), p0, p1, uv0, uv1);
+}
+
+static void DrawLargeImage(rlImGuiLargeImage* image, ImDrawList* drawList, const ImRect& bb)
+{
+    // the level with at least one texel for every screen pixel
+    float pixelsPerTexel = image->Zoom * GetFramebufferScale().x;
+    int level = ImClamp(int(floorf(log2f(1.0f / pixelsPerTexel))), 0, image->Levels - 1);
+
+    ImVec2 origin(bb.Min.x + bb.GetWidth() * 0.5f - image->Center.x * image->Zoom, bb.Min.y + bb.GetHeight() * 0.5f - image->Center.y * image->Zoom);
+    float span = float(LargeImageTileSize << level);
+    int firstColumn = int(floorf((bb.Min.x - origin.x) / image->Zoom / span));
+    int lastColumn = int(floorf((bb.Max.x - origin.x) / image->Zoom / span));
+    int firstRow = int(floorf((bb.Min.y - origin.y) / image->Zoom / span));
+    int lastRow = int(floorf((bb.Max.y - origin.y) / image->Zoom / span));
+
+    int columns = image->LevelColumns[level];
+    int rows = image->LevelRows[level];
+
+    // one ring of tiles around the view is loaded ahead for panning, they are asked for first so they load last
+    for (int row = ImMax(firstRow - 1, 0); row <= ImMin(lastRow + 1, rows - 1); row++)
+    {
+        for (int column = ImMax(firstColumn - 1, 0); column <= ImMin(lastColumn + 1, columns - 1); column++)
         {
-            if (tex->Status != ImTextureStatus_OK)
-                ImGui_ImplRaylib_UpdateTexture(tex);
+            if (row < firstRow || row > lastRow || column < firstColumn || column > lastColumn)
+                RequestLargeImageTile(image, level, column, row);
         }
     }
 
-    rlDrawRenderBatchActive();
-    rlDisableBackfaceCulling();
+    int firstVisibleRequest = LargeImageRequests.Size;
 
-    for (int l = 0; l < draw_data->CmdListsCount; ++l)
+    drawList->PushClipRect(bb.Min, bb.Max, true);
+    for (int row = ImMax(firstRow, 0); row <= ImMin(lastRow, rows - 1); row++)
     {
-        const ImDrawList* commandList = draw_data->CmdLists[l];
-
-        for (const auto& cmd : commandList->CmdBuffer)
+        for (int column = ImMax(firstColumn, 0); column <= ImMin(lastColumn, columns - 1); column++)
         {
-            EnableScissor(cmd.ClipRect.x - draw_data->DisplayPos.x, cmd.ClipRect.y - draw_data->DisplayPos.y, cmd.ClipRect.z - (cmd.ClipRect.x - draw_data->DisplayPos.x), cmd.ClipRect.w - (cmd.ClipRect.y - draw_data->DisplayPos.y));
-            if (cmd.UserCallback != nullptr)
-			{
-				rlSetTexture(0); // force the texture state to the default since we don't know what the user callback will do with it
-                cmd.UserCallback(commandList, &cmd);
-            }
-            else
+            float x0 = column * span;
+            float y0 = row * span;
+            float x1 = x0 + float(GetLargeImageTileWidth(image, level, column) << level);
+            float y1 = y0 + float(GetLargeImageTileHeight(image, level, row) << level);
+
+            LargeImageTile* tile = RequestLargeImageTile(image, level, column, row);
+            if (!tile)
             {
-                ImGuiRenderTriangles(cmd.ElemCount, cmd.IdxOffset, commandList->IdxBuffer, commandList->VtxBuffer, cmd.GetTexID());
+                // until it is loaded, the part of the closest coarser tile that is loaded is drawn instead
+                for (int coarser = level + 1; coarser < image->Levels && !tile; coarser++)
+                {
+                    tile = image->Tiles[GetLargeImageTileIndex(image, coarser, column >> (coarser - level), row >> (coarser - level))];
+                    if (tile && tile->State.load(std::memory_order_relaxed) != LargeImageTile_Ready)
+                        tile = nullptr;
+                }
+
+                if (!tile)
+                    continue;
+
+                tile->LastUsedFrame = LargeImageFrame;
+                LargeImageFallbackTiles++;
             }
-            rlDrawRenderBatchActive();
+
+            DrawLargeImageTile(image, drawList, origin, tile, x0, y0, x1, y1);
+            LargeImageTilesDrawn++;
         }
     }
+    drawList->PopClipRect();
+
+    // the tiles nearest the center of the view are loaded first
+    float centerColumn = image->Center.x / span - 0.5f;
+    float centerRow = image->Center.y / span - 0.5f;
+    auto distance = [centerColumn, centerRow](const LargeImageTile* tile) { float x = tile->Column - centerColumn; float y = tile->Row - centerRow; return x * x + y * y; };
+    std::sort(LargeImageRequests.begin() + firstVisibleRequest, LargeImageRequests.end(),
+        [&distance](const LargeImageTile* a, const LargeImageTile* b) { return distance(a) > distance(b); });
+
+    // the single tile of the top level is always kept, so there is something to draw anywhere
+    RequestLargeImageTile(image, image->Levels - 1, 0, 0);
+    QueueLargeImageRequests();
+}
 
-    rlSetTexture(0);
-    rlDisableScissorTest();
-    rlEnableBackfaceCulling();
+bool rlImGuiLargeImageView(rlImGuiLargeImage* image, Vector2 size)
+{
+    if (!image)
+        return false;
+
+    SetFrameContext();
+
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImVec2 avail = ImGui::GetContentRegionAvail();
+    ImVec2 itemSize(size.x > 0 ? size.x : avail.x, size.y > 0 ? size.y : avail.y);
+    itemSize = ImVec2(ImFloor(ImMax(itemSize.x, 0.0f)), ImFloor(ImMax(itemSize.y, 0.0f)));
+
+    ImVec2 pos = ImGui::GetCursorScreenPos();
+    ImRect bb(pos, ImVec2(pos.x + itemSize.x, pos.y + itemSize.y));
+    ImGuiID id = ImGui::GetID(image);
+    ImGui::ItemSize(itemSize);
+
+    // scrolled out of the window, no tiles are asked for
+    if (!ImGui::ItemAdd(bb, id) || itemSize.x < 1 || itemSize.y < 1)
+        return false;
+
+    if (image->Zoom <= 0)
+        FitLargeImage(image, itemSize);
+
+    // drag to pan, the wheel zooms around the mouse and a double click fits the image again
+    bool hovered = false;
+    bool held = false;
+    ImGui::ButtonBehavior(bb, id, &hovered, &held, ImGuiButtonFlags_MouseButtonLeft | ImGuiButtonFlags_MouseButtonMiddle);
+
+    ImGuiIO& io = ImGui::GetIO();
+    if (held)
+    {
+        image->Center.x -= io.MouseDelta.x / image->Zoom;
+        image->Center.y -= io.MouseDelta.y / image->Zoom;
+    }
+
+    if (hovered)
+    {
+        ImGui::SetItemKeyOwner(ImGuiKey_MouseWheelY);
+        if (io.MouseWheel != 0)
+        {
+            float fit = ImMin(itemSize.x / image->Width, itemSize.y / image->Height);
+            image->TargetZoom = ImClamp(image->TargetZoom * powf(1.25f, io.MouseWheel), fit * 0.5f, 32.0f);
+            image->ZoomAnchor = io.MousePos;
+        }
+
+        if (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+            FitLargeImage(image, itemSize);
+    }
+
+    // the zoom eases to the target, keeping the image pixel under the anchor still
+    if (image->Zoom != image->TargetZoom)
+    {
+        ImVec2 center = bb.GetCenter();
+        float anchorX = image->Center.x + (image->ZoomAnchor.x - center.x) / image->Zoom;
+        float anchorY = image->Center.y + (image->ZoomAnchor.y - center.y) / image->Zoom;
+
+        float zoom = expf(ImLerp(logf(image->Zoom), logf(image->TargetZoom), 1.0f - expf(-io.DeltaTime * 15.0f)));
+        if (fabsf(zoom / image->TargetZoom - 1.0f) < 0.001f)
+            zoom = image->TargetZoom;
+
+        image->Center.x = anchorX - (image->ZoomAnchor.x - center.x) / zoom;
+        image->Center.y = anchorY - (image->ZoomAnchor.y - center.y) / zoom;
+        image->Zoom = zoom;
+    }
+
+    image->Center.x = ImClamp(image->Center.x, 0.0f, float(image->Width));
+    image->Center.y = ImClamp(image->Center.y, 0.0f, float(image->Height));
+
+    DrawLargeImage(image, window->DrawList, bb);
+    return true;
 }
 
-void HandleGamepadButtonEvent(ImGuiIO& io, GamepadButton button, ImGuiKey key)
+void rlImGuiSetLargeImageView(rlImGuiLargeImage* image, Vector2 center, float zoom)
 {
-    if (IsGamepadButtonPressed(0, button))
-        io.AddKeyEvent(key, true);
-    else if (IsGamepadButtonReleased(0, button))
-        io.AddKeyEvent(key, false);
+    if (!image)
+        return;
+
+    image->Center = center;
+    image->Zoom = zoom > 0 ? zoom : 0;
+    image->TargetZoom = image->Zoom;
 }
 
-void HandleGamepadStickEvent(ImGuiIO& io, GamepadAxis axis, ImGuiKey negKey, ImGuiKey posKey)
+void rlImGuiGetLargeImageView(const rlImGuiLargeImage* image, Vector2* center, float* zoom)
 {
-    constexpr float deadZone = 0.20f;
+    if (!image)
+        return;
 
-    float axisValue = GetGamepadAxisMovement(0, axis);
+    if (center)
+        *center = image->Center;
+    if (zoom)
+        *zoom = image->Zoom;
+}
+
+Vector2 rlImGuiGetLargeImageSize(const rlImGuiLargeImage* image)
+{
+    if (!image)
+        return Vector2{ 0, 0 };
 
-    io.AddKeyAnalogEvent(negKey, axisValue < -deadZone, axisValue < -deadZone ? -axisValue : 0);
-    io.AddKeyAnalogEvent(posKey, axisValue > deadZone, axisValue > deadZone ? axisValue : 0);
+    return Vector2{ float(image->Width), float(image->Height) };
 }
 
-bool ImGui_ImplRaylib_ProcessEvents(void)
+void rlImGuiSetLargeImageLimits(long long budgetBytes, int uploadsPerFrame)
 {
-    ImGuiIO& io = ImGui::GetIO();
+    if (budgetBytes > 0)
+        LargeImageBudget = budgetBytes;
+    if (uploadsPerFrame > 0)
+        LargeImageUploadsPerFrame = uploadsPerFrame;
+}
 
-    bool focused = IsWindowFocused();
-    if (focused != LastFrameFocused)
-        io.AddFocusEvent(focused);
-    LastFrameFocused = focused;
+bool rlImGuiGetLargeImageStats(rlImGuiLargeImageStats* stats)
+{
+    if (!stats)
+        return false;
 
-    // handle the modifyer key events so that shortcuts work
-    bool ctrlDown = rlImGuiIsControlDown();
-    if (ctrlDown != LastControlPressed)
-        io.AddKeyEvent(ImGuiMod_Ctrl, ctrlDown);
-    LastControlPressed = ctrlDown;
+    *stats = LargeImageStats;
+    stats->Images = LargeImages.Size;
+    stats->Tiles = 0;
+    for (const LargeImageTile* tile : LargeImageCache)
+    {
+        if (tile->Texture.id != 0)
+            stats->Tiles++;
+    }
+    stats->TileBytes = LargeImageBytes;
+    stats->BudgetBytes = LargeImageBudget;
+    stats->PendingTiles = LargeImageTilesInFlight.Size;
+    stats->AverageLoadMs = LargeImageStats.Loads > 0 ? float(LargeImageLoadMs / LargeImageStats.Loads) : 0.0f;
+    return true;
+}
 
-    bool shiftDown = rlImGuiIsShiftDown();
-    if (shiftDown != LastShiftPressed)
-        io.AddKeyEvent(ImGuiMod_Shift, shiftDown);
-    LastShiftPressed = shiftDown;
+// streaming textures
+// Producers on any thread write frames into CPU buffers, and the newest finished frame is handed to the main thread through
+// one atomic slot. A buffer is always in exactly one place: free, being written by a producer, waiting in the slot or held
+// by the main thread as the frame it uploaded last, so nothing blocks. A frame that is replaced in the slot before the main
+// thread takes it is dropped. Frames are uploaded to the textures in turn, so the texture being written is not the one the
+// GPU may still be drawing from the frames before.
+static constexpr int StreamTextureBuffers = 4;
+static constexpr int StreamTextureNoBuffer = 0xFF;
+static constexpr int StreamTextureFresh = 0x100;    // set in the slot when the frame in it was not taken yet
+static constexpr int StreamTextureMaxTextures = 8;
+
+struct StreamFrameBuffer
+{
+    unsigned char* Pixels = nullptr;
+    double PushTime = 0;
+};
 
-    bool altDown = rlImGuiIsAltDown();
-    if (altDown != LastAltPressed)
-        io.AddKeyEvent(ImGuiMod_Alt, altDown);
-    LastAltPressed = altDown;
+struct rlImGuiStreamTexture
+{
+    int Width = 0;
+    int Height = 0;
+    int Format = 0;
+    int FrameBytes = 0;
+
+    StreamFrameBuffer Buffers[StreamTextureBuffers];
+    std::atomic<unsigned int> FreeBuffers{ (1u << StreamTextureBuffers) - 1 };
+    std::atomic<int> Latest{ StreamTextureNoBuffer };
+    int Reading = StreamTextureNoBuffer;    // the buffer of the frame uploaded last, only used by the main thread
+
+    ImVector<Texture2D> Textures;
+    int Current = -1;                       // the texture with the newest frame, -1 until there is one
+    unsigned int LastPullFrame = 0;
+
+    std::atomic<unsigned int> Pushed{ 0 };
+    std::atomic<unsigned int> Dropped{ 0 };
+    std::atomic<unsigned int> Rejected{ 0 };
+    unsigned int Uploaded = 0;
+    float UploadMs = 0;
+    float LatencyMs = 0;
+
+    // rates, measured over about a second
+    double RateStart = 0;
+    unsigned int RatePushed = 0;
+    unsigned int RateUploaded = 0;
+    float PushedPerSecond = 0;
+    float UploadedPerSecond = 0;
+};
 
-    bool superDown = rlImGuiIsSuperDown();
-    if (superDown != LastSuperPressed)
-        io.AddKeyEvent(ImGuiMod_Super, superDown);
-    LastSuperPressed = superDown;
+static ImVector<rlImGuiStreamTexture*> StreamTextures;
+static unsigned int StreamTextureFrame = 1;
 
-    // walk the keymap and check for up and down events
-	for (int keyItr = 0; keyItr < MAX_RAYLIB_KEY; keyItr++)
-    {
-        const auto key = RaylibKeyMap[keyItr];
+rlImGuiStreamTexture* rlImGuiCreateStreamTexture(int width, int height, int format, int textureCount)
+{
+    if (width <= 0 || height <= 0)
+        return nullptr;
 
-        if (key == 0)
-            continue;
+    if (format <= 0)
+        format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    textureCount = textureCount > 0 ? ImMin(textureCount, StreamTextureMaxTextures) : 3;
 
-        if (IsKeyReleased(keyItr))
-            io.AddKeyEvent(key, false);
-        else if(IsKeyPressed(keyItr))
-            io.AddKeyEvent(key, true);
-    }
+    rlImGuiStreamTexture* stream = IM_NEW(rlImGuiStreamTexture)();
+    stream->Width = width;
+    stream->Height = height;
+    stream->Format = format;
+    stream->FrameBytes = GetPixelDataSize(width, height, format);
+
+    for (StreamFrameBuffer& buffer : stream->Buffers)
+        buffer.Pixels = (unsigned char*)MemAlloc(unsigned(stream->FrameBytes));
 
-    if (io.WantCaptureKeyboard)
+    // the textures start empty, they are filled by the frames
+    Image empty = { nullptr, width, height, 1, format };
+    for (int i = 0; i < textureCount; i++)
     {
-        // add the text input in order
-        unsigned int pressed = GetCharPressed();
-        while (pressed != 0)
-        {
-            io.AddInputCharacter(pressed);
-            pressed = GetCharPressed();
-        }
+        stream->Textures.push_back(LoadTextureFromImage(empty));
+        SetTextureFilter(stream->Textures.back(), TEXTURE_FILTER_BILINEAR);
     }
 
-    bool processsMouse = focused;
+    stream->RateStart = GetTime();
+    StreamTextures.push_back(stream);
+    return stream;
+}
 
-#if defined(RLIMGUI_ALWAYS_TRACK_MOUSE)
-    processsMouse = true;
-#endif
+void rlImGuiDestroyStreamTexture(rlImGuiStreamTexture* stream)
+{
+    if (!stream)
+        return;
 
-    if (processsMouse)
-    {
-        if (!io.WantSetMousePos)
-        {
-            io.AddMousePosEvent(float(GetMouseX()), float(GetMouseY()));
-        }
+    for (const Texture2D& texture : stream->Textures)
+        UnloadTexture(texture);
 
-        auto setMouseEvent = [&io](int rayMouse, int imGuiMouse)
-            {
-                if (IsMouseButtonPressed(rayMouse))
-                    io.AddMouseButtonEvent(imGuiMouse, true);
-                else if (IsMouseButtonReleased(rayMouse))
-                    io.AddMouseButtonEvent(imGuiMouse, false);
-            };
+    for (StreamFrameBuffer& buffer : stream->Buffers)
+        MemFree(buffer.Pixels);
 
-        setMouseEvent(MOUSE_BUTTON_LEFT, ImGuiMouseButton_Left);
-        setMouseEvent(MOUSE_BUTTON_RIGHT, ImGuiMouseButton_Right);
-        setMouseEvent(MOUSE_BUTTON_MIDDLE, ImGuiMouseButton_Middle);
-        setMouseEvent(MOUSE_BUTTON_FORWARD, ImGuiMouseButton_Middle + 1);
-        setMouseEvent(MOUSE_BUTTON_BACK, ImGuiMouseButton_Middle + 2);
+    StreamTextures.find_erase(stream);
+    IM_DELETE(stream);
+}
 
-        {
-            Vector2 mouseWheel = GetMouseWheelMoveV();
-            io.AddMouseWheelEvent(mouseWheel.x, mouseWheel.y);
-        }
+static void DestroyStreamTextures(void)
+{
+    while (!StreamTextures.empty())
+        rlImGuiDestroyStreamTexture(StreamTextures.back());
+}
+
+void* rlImGuiBeginStreamFrame(rlImGuiStreamTexture* stream)
+{
+    if (!stream)
+        return nullptr;
+
+    unsigned int free = stream->FreeBuffers.load(std::memory_order_relaxed);
+    while (free != 0)
+    {
+        int index = 0;
+        while ((free & (1u << index)) == 0)
+            index++;
+
+        if (stream->FreeBuffers.compare_exchange_weak(free, free & ~(1u << index), std::memory_order_acquire, std::memory_order_relaxed))
+            return stream->Buffers[index].Pixels;
     }
-    else
+
+    // every buffer is being written by another producer or waiting to be shown
+    stream->Rejected.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+bool rlImGuiEndStreamFrame(rlImGuiStreamTexture* stream, void* pixels)
+{
+    if (!stream || !pixels)
+        return false;
+
+    int index = 0;
+    while (index < StreamTextureBuffers && stream->Buffers[index].Pixels != pixels)
+        index++;
+
+    if (index == StreamTextureBuffers)
+        return false;
+
+    stream->Buffers[index].PushTime = GetTime();
+    stream->Pushed.fetch_add(1, std::memory_order_relaxed);
+
+    // the buffer that was in the slot is free again, if the main thread never took it the frame in it was dropped
+    int previous = stream->Latest.exchange(index | StreamTextureFresh, std::memory_order_acq_rel);
+    if (previous != StreamTextureNoBuffer)
     {
-        io.AddMousePosEvent(std::numeric_limits<float>::min(), std::numeric_limits<float>::min());
+        if (previous & StreamTextureFresh)
+            stream->Dropped.fetch_add(1, std::memory_order_relaxed);
+        stream->FreeBuffers.fetch_or(1u << (previous & 0xFF), std::memory_order_release);
     }
+    return true;
+}
 
-    if (io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad && IsGamepadAvailable(0))
+bool rlImGuiPushStreamFrame(rlImGuiStreamTexture* stream, const void* pixels)
+{
+    if (!pixels)
+        return false;
+
+    void* buffer = rlImGuiBeginStreamFrame(stream);
+    if (!buffer)
+        return false;
+
+    memcpy(buffer, pixels, size_t(stream->FrameBytes));
+    return rlImGuiEndStreamFrame(stream, buffer);
+}
+
+// takes the newest frame from the slot and uploads it, at most once a frame
+static void PullStreamFrame(rlImGuiStreamTexture* stream)
+{
+    if (stream->LastPullFrame == StreamTextureFrame)
+        return;
+    stream->LastPullFrame = StreamTextureFrame;
+
+    if ((stream->Latest.load(std::memory_order_relaxed) & StreamTextureFresh) == 0)
+        return;
+
+    // only producers put fresh frames in the slot, so the frame taken is fresh even if it is newer than the one seen above.
+    // the buffer of the last upload goes back in its place and the next producer frees it
+    int latest = stream->Latest.exchange(stream->Reading, std::memory_order_acq_rel);
+    stream->Reading = latest & 0xFF;
+
+    double start = GetTime();
+    const StreamFrameBuffer& buffer = stream->Buffers[stream->Reading];
+    stream->Current = (stream->Current + 1) % stream->Textures.Size;
+    UpdateTexture(stream->Textures[stream->Current], buffer.Pixels);
+
+    double end = GetTime();
+    stream->UploadMs = float((end - start) * 1000.0);
+    stream->LatencyMs = float((end - buffer.PushTime) * 1000.0);
+    stream->Uploaded++;
+}
+
+// frames are counted by the default context, like the render texture pool
+static void EndStreamTextureFrame(void)
+{
+    StreamTextureFrame++;
+
+    double now = GetTime();
+    for (rlImGuiStreamTexture* stream : StreamTextures)
     {
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_FACE_UP, ImGuiKey_GamepadDpadUp);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_FACE_RIGHT, ImGuiKey_GamepadDpadRight);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_FACE_DOWN, ImGuiKey_GamepadDpadDown);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_FACE_LEFT, ImGuiKey_GamepadDpadLeft);
+        double elapsed = now - stream->RateStart;
+        if (elapsed < 1.0)
+            continue;
 
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_FACE_UP, ImGuiKey_GamepadFaceUp);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT, ImGuiKey_GamepadFaceLeft);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_FACE_DOWN, ImGuiKey_GamepadFaceDown);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_FACE_LEFT, ImGuiKey_GamepadFaceRight);
+        unsigned int pushed = stream->Pushed.load(std::memory_order_relaxed);
+        stream->PushedPerSecond = float((pushed - stream->RatePushed) / elapsed);
+        stream->UploadedPerSecond = float((stream->Uploaded - stream->RateUploaded) / elapsed);
+        stream->RatePushed = pushed;
+        stream->RateUploaded = stream->Uploaded;
+        stream->RateStart = now;
+    }
+}
 
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_TRIGGER_1, ImGuiKey_GamepadL1);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_TRIGGER_2, ImGuiKey_GamepadL2);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_TRIGGER_1, ImGuiKey_GamepadR1);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_TRIGGER_2, ImGuiKey_GamepadR2);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_LEFT_THUMB, ImGuiKey_GamepadL3);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_RIGHT_THUMB, ImGuiKey_GamepadR3);
+const Texture* rlImGuiGetStreamTexture(rlImGuiStreamTexture* stream)
+{
+    if (!stream)
+        return nullptr;
 
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_MIDDLE_LEFT, ImGuiKey_GamepadStart);
-        HandleGamepadButtonEvent(io, GAMEPAD_BUTTON_MIDDLE_RIGHT, ImGuiKey_GamepadBack);
+    PullStreamFrame(stream);
+    return stream->Current >= 0 ? &stream->Textures[stream->Current] : nullptr;
+}
 
-        // left stick
-        HandleGamepadStickEvent(io, GAMEPAD_AXIS_LEFT_X, ImGuiKey_GamepadLStickLeft, ImGuiKey_GamepadLStickRight);
-        HandleGamepadStickEvent(io, GAMEPAD_AXIS_LEFT_Y, ImGuiKey_GamepadLStickUp, ImGuiKey_GamepadLStickDown);
+bool rlImGuiStreamImage(rlImGuiStreamTexture* stream, Vector2 size)
+{
+    if (!stream)
+        return false;
 
-        // right stick
-        HandleGamepadStickEvent(io, GAMEPAD_AXIS_RIGHT_X, ImGuiKey_GamepadRStickLeft, ImGuiKey_GamepadRStickRight);
-        HandleGamepadStickEvent(io, GAMEPAD_AXIS_RIGHT_Y, ImGuiKey_GamepadRStickUp, ImGuiKey_GamepadRStickDown);
+    SetFrameContext();
+
+    // a hidden image does not upload, the frames pushed meanwhile are dropped
+    if (ImGui::GetCurrentWindow()->SkipItems)
+        return false;
+
+    float aspect = float(stream->Width) / float(stream->Height);
+    ImVec2 itemSize(size.x, size.y);
+    if (itemSize.x <= 0 && itemSize.y <= 0)
+    {
+        ImVec2 avail = ImGui::GetContentRegionAvail();
+        itemSize = ImVec2(avail.x, avail.x / aspect);
+        if (avail.y > 0 && itemSize.y > avail.y)
+            itemSize = ImVec2(avail.y * aspect, avail.y);
+    }
+    else if (itemSize.x <= 0)
+    {
+        itemSize.x = itemSize.y * aspect;
+    }
+    else if (itemSize.y <= 0)
+    {
+        itemSize.y = itemSize.x / aspect;
+    }
+
+    const Texture* texture = rlImGuiGetStreamTexture(stream);
+    if (!texture)
+    {
+        ImGui::Dummy(itemSize);
+        return false;
     }
 
+    ImGui::Image(ImTextureID(texture->id), itemSize);
+    return true;
+}
+
+bool rlImGuiGetStreamTextureStats(const rlImGuiStreamTexture* stream, rlImGuiStreamTextureStats* stats)
+{
+    if (!stream || !stats)
+        return false;
+
+    stats->Pushed = stream->Pushed.load(std::memory_order_relaxed);
+    stats->Uploaded = stream->Uploaded;
+    stats->Dropped = stream->Dropped.load(std::memory_order_relaxed);
+    stats->Rejected = stream->Rejected.load(std::memory_order_relaxed);
+    stats->PushedPerSecond = stream->PushedPerSecond;
+    stats->UploadedPerSecond = stream->UploadedPerSecond;
+    stats->UploadMegabytesPerSecond = float(stream->UploadedPerSecond * double(stream->FrameBytes) / (1024.0 * 1024.0));
+    stats->UploadMs = stream->UploadMs;
+    stats->LatencyMs = stream->LatencyMs;
+    stats->Textures = stream->Textures.Size;
+    stats->TextureBytes = (long long)stream->FrameBytes * stream->Textures.Size;
     return true;
 }
@@ -92,6 +92,20 @@ RLIMGUIAPI void rlImGuiEnd(void);
 /// </summary>
 RLIMGUIAPI void rlImGuiShutdown(void);
 
+/// <summary>
+/// Starts setting up rlImGui with the fonts built on a worker thread, so the app can draw a loading screen with raylib meanwhile.
+/// The default context is made on the main thread once the fonts are done, the first time rlImGuiIsReady returns true.
+/// rlImGuiBegin, rlImGuiCreateContext and rlImGuiShutdown wait for the fonts if they are called before that.
+/// Fonts can not be added with this setup, use rlImGuiBeginInitImGui and rlImGuiEndInitImGui for custom fonts.
+/// </summary>
+/// <param name="darkTheme">when true(default) the dark theme is used, when false the light theme is used</param>
+RLIMGUIAPI void rlImGuiSetupAsync(bool darkTheme);
+
+/// <summary>
+/// Returns true when rlImGui is set up and ready for rlImGuiBegin, finishing an async setup if the fonts are done
+/// </summary>
+RLIMGUIAPI bool rlImGuiIsReady(void);
+
 // Advanced StartupAPI
 
 /// <summary>
@@ -188,6 +202,1192 @@ bool rlImGuiImageButton(const char* name, const Texture* image);
 /// <returns>True if the button was clicked</returns>
 RLIMGUIAPI bool rlImGuiImageButtonSize(const char* name, const Texture* image, Vector2 size);
 
+// Image options API
+// Draws images with a different filter, wrap or shader than the texture has, such as pixel art with point filtering next to a smooth photo.
+// The options are added to the window draw list as draw callbacks, the renderer only changes the shader or the sampler of a texture
+// when a draw needs something different, so images with the same options one after another do not change any state.
+// The filter and wrap only apply to user textures set with rlImGuiSetTextureSampler, the shader applies to everything drawn in the window while the options are pushed.
+// Options do not carry over into child windows, push them again inside the child.
+
+typedef struct rlImGuiImageOptions
+{
+    int Filter;                     // the TextureFilter to draw with, -1 for the filter of the texture
+    int Wrap;                       // the TextureWrap to draw with, -1 for the wrap of the texture
+    Shader DrawShader;              // the shader to draw with, a shader with an id of 0 uses the default shader
+} rlImGuiImageOptions;
+
+typedef struct rlImGuiImageOptionsStats
+{
+    int OptionCommands;             // option callbacks in the last draw data that was rendered
+    int ShaderChanges;              // times the shader was changed while rendering it
+    int SamplerChanges;             // times the filter and wrap of a texture were changed while rendering it
+} rlImGuiImageOptionsStats;
+
+/// <summary>
+/// Gets image options that change nothing, set the fields to change from them
+/// </summary>
+/// <returns>Options with no filter, wrap or shader</returns>
+RLIMGUIAPI rlImGuiImageOptions rlImGuiDefaultImageOptions(void);
+
+/// <summary>
+/// Uses options for the images drawn in the current window until rlImGuiPopImageOptions
+/// </summary>
+/// <param name="options">The options to use, NULL for the defaults</param>
+RLIMGUIAPI void rlImGuiPushImageOptions(const rlImGuiImageOptions* options);
+
+/// <summary>
+/// Goes back to the options used before the last rlImGuiPushImageOptions, pushes and pops must match in a window
+/// </summary>
+RLIMGUIAPI void rlImGuiPopImageOptions(void);
+
+/// <summary>
+/// Draws a texture as an image with options. Uses the current ImGui cursor position and the specified size.
+/// </summary>
+/// <param name="image">The texture to draw</param>
+/// <param name="size">The size to draw the image at, 0 uses the size of the texture</param>
+/// <param name="options">The options to draw with, NULL for the defaults</param>
+RLIMGUIAPI void rlImGuiImageEx(const Texture* image, Vector2 size, const rlImGuiImageOptions* options);
+
+/// <summary>
+/// Draws a texture as an image button with options. Uses the current ImGui cursor position and the specified size.
+/// </summary>
+/// <param name="name">The display name and ImGui ID for the button</param>
+/// <param name="image">The texture to draw</param>
+/// <param name="size">The size of the button, 0 uses the size of the texture</param>
+/// <param name="options">The options to draw the image with, NULL for the defaults</param>
+/// <returns>True if the button was clicked</returns>
+RLIMGUIAPI bool rlImGuiImageButtonEx(const char* name, const Texture* image, Vector2 size, const rlImGuiImageOptions* options);
+
+/// <summary>
+/// Sets the filter and wrap of a texture, like SetTextureFilter and SetTextureWrap, and tells rlImGui about them.
+/// After an image is drawn with other options its texture is set back to these. Other textures keep their own filter and wrap, and drawing them with other options logs a warning.
+/// </summary>
+/// <param name="texture">The texture to change</param>
+/// <param name="filter">The TextureFilter to use</param>
+/// <param name="wrap">The TextureWrap to use</param>
+RLIMGUIAPI void rlImGuiSetTextureSampler(const Texture* texture, int filter, int wrap);
+
+/// <summary>
+/// Gets how much state the image options changed in the last draw data that was rendered
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetImageOptionsStats(rlImGuiImageOptionsStats* stats);
+
+// Image batch API
+// Draws many images, such as the sprites of a palette, in one call. The images are written straight into the window draw list,
+// images outside the window are skipped, and images that use the same texture one after another share a draw command.
+
+typedef struct rlImGuiImageBatchEntry
+{
+    const Texture* Image;           // the texture to draw from
+    Rectangle Source;               // the part of the texture to draw, a negative width or height flips it like DrawTexturePro
+    Rectangle Dest;                 // where to draw it, relative to the ImGui cursor position
+    Color Tint;                     // the color to multiply the image by, WHITE for none
+} rlImGuiImageBatchEntry;
+
+/// <summary>
+/// Draws a batch of images at the current ImGui cursor position, the batch takes up the space of its largest Dest
+/// </summary>
+/// <param name="entries">The images to draw</param>
+/// <param name="count">The number of entries</param>
+RLIMGUIAPI void rlImGuiImageBatch(const rlImGuiImageBatchEntry* entries, int count);
+
+/// <summary>
+/// Sets the Dest of every entry to lay the images out in a grid of cells, each image is fit to its cell keeping its aspect.
+/// Cells are spaced by the ImGui item spacing.
+/// </summary>
+/// <param name="entries">The images to lay out</param>
+/// <param name="count">The number of entries</param>
+/// <param name="cellSize">The size of a cell</param>
+/// <param name="columns">The number of columns, 0 fits as many as the content area can hold</param>
+/// <returns>The number of columns used</returns>
+RLIMGUIAPI int rlImGuiLayoutImageGrid(rlImGuiImageBatchEntry* entries, int count, Vector2 cellSize, int columns);
+
+/// <summary>
+/// Draws images as a grid of cells at the current ImGui cursor position, only the rows that are visible are laid out and drawn.
+/// The Dest of the entries is not used, each image is fit to its cell keeping its aspect.
+/// </summary>
+/// <param name="name">The ImGui ID of the grid</param>
+/// <param name="entries">The images to draw</param>
+/// <param name="count">The number of entries</param>
+/// <param name="cellSize">The size of a cell</param>
+/// <param name="columns">The number of columns, 0 fits as many as the content area can hold</param>
+/// <param name="hoveredIndex">Set to the entry under the mouse or -1, can be NULL</param>
+/// <returns>The entry that was clicked this frame or -1</returns>
+RLIMGUIAPI int rlImGuiImageGrid(const char* name, const rlImGuiImageBatchEntry* entries, int count, Vector2 cellSize, int columns, int* hoveredIndex);
+
+// Sprite sheet API
+// A texture split into frames. The UVs of every frame, and of every flip of it, are worked out when the sheet is made,
+// so drawing a frame or an animation does no math beyond picking the frame.
+// The texture is owned by the caller and must stay loaded while the sheet is used.
+
+typedef struct rlImGuiSpriteSheet rlImGuiSpriteSheet;
+
+/// <summary>
+/// Makes a sprite sheet from a texture split into a grid of frames of the same size, read left to right then top to bottom
+/// </summary>
+/// <param name="texture">The sprite sheet texture</param>
+/// <param name="frameWidth">The width of a frame</param>
+/// <param name="frameHeight">The height of a frame</param>
+/// <param name="frameCount">The number of frames, 0 uses every cell of the grid</param>
+/// <returns>The sprite sheet, or NULL if the texture or frame size is not valid</returns>
+RLIMGUIAPI rlImGuiSpriteSheet* rlImGuiCreateSpriteSheetGrid(const Texture* texture, int frameWidth, int frameHeight, int frameCount);
+
+/// <summary>
+/// Makes a sprite sheet from a texture and a list of frame rectangles, for packed sheets with frames of different sizes
+/// </summary>
+/// <param name="texture">The sprite sheet texture</param>
+/// <param name="frames">The rectangle of each frame in the texture, copied into the sheet</param>
+/// <param name="frameCount">The number of frames</param>
+/// <returns>The sprite sheet, or NULL if the texture or frames are not valid</returns>
+RLIMGUIAPI rlImGuiSpriteSheet* rlImGuiCreateSpriteSheetFrames(const Texture* texture, const Rectangle* frames, int frameCount);
+
+/// <summary>
+/// Destroys a sprite sheet, the texture is not unloaded
+/// </summary>
+/// <param name="sheet">The sprite sheet to destroy</param>
+RLIMGUIAPI void rlImGuiDestroySpriteSheet(rlImGuiSpriteSheet* sheet);
+
+/// <summary>
+/// Gets the number of frames in a sprite sheet
+/// </summary>
+/// <param name="sheet">The sprite sheet</param>
+/// <returns>The number of frames</returns>
+RLIMGUIAPI int rlImGuiGetSpriteSheetFrameCount(const rlImGuiSpriteSheet* sheet);
+
+/// <summary>
+/// Gets the size of a frame in the texture
+/// </summary>
+/// <param name="sheet">The sprite sheet</param>
+/// <param name="frame">The frame index</param>
+/// <returns>The size of the frame, 0 if the frame is not in the sheet</returns>
+RLIMGUIAPI Vector2 rlImGuiGetSpriteFrameSize(const rlImGuiSpriteSheet* sheet, int frame);
+
+/// <summary>
+/// Draws a frame of a sprite sheet as an image in an ImGui Context
+/// </summary>
+/// <param name="sheet">The sprite sheet</param>
+/// <param name="frame">The frame index</param>
+/// <param name="size">The size of the drawn image, 0 uses the size of the frame</param>
+RLIMGUIAPI void rlImGuiSprite(const rlImGuiSpriteSheet* sheet, int frame, Vector2 size);
+
+/// <summary>
+/// Draws a frame of a sprite sheet as an image in an ImGui Context, flipped and tinted
+/// </summary>
+/// <param name="sheet">The sprite sheet</param>
+/// <param name="frame">The frame index</param>
+/// <param name="size">The size of the drawn image, 0 uses the size of the frame</param>
+/// <param name="flipX">Flip the frame left to right</param>
+/// <param name="flipY">Flip the frame top to bottom</param>
+/// <param name="tint">The color to multiply the frame by</param>
+RLIMGUIAPI void rlImGuiSpriteEx(const rlImGuiSpriteSheet* sheet, int frame, Vector2 size, bool flipX, bool flipY, Color tint);
+
+/// <summary>
+/// Draws a frame of a sprite sheet as an image button in an ImGui context
+/// </summary>
+/// <param name="name">The display name and ImGui ID for the button</param>
+/// <param name="sheet">The sprite sheet</param>
+/// <param name="frame">The frame index</param>
+/// <param name="size">The size of the button image, 0 uses the size of the frame</param>
+/// <returns>True if the button was clicked</returns>
+RLIMGUIAPI bool rlImGuiSpriteButton(const char* name, const rlImGuiSpriteSheet* sheet, int frame, Vector2 size);
+
+/// <summary>
+/// Gets the frame of an animation at a time
+/// </summary>
+/// <param name="firstFrame">The first frame of the animation</param>
+/// <param name="frameCount">The number of frames in the animation</param>
+/// <param name="framesPerSecond">The playback rate</param>
+/// <param name="time">The time since the animation started, in seconds</param>
+/// <param name="loop">When true the animation loops, when false it stays on the last frame</param>
+/// <returns>The frame index to draw</returns>
+RLIMGUIAPI int rlImGuiGetSpriteAnimationFrame(int firstFrame, int frameCount, float framesPerSecond, double time, bool loop);
+
+/// <summary>
+/// Draws a looping animation from a sprite sheet, timed by the ImGui clock so every preview of it is in step
+/// </summary>
+/// <param name="sheet">The sprite sheet</param>
+/// <param name="firstFrame">The first frame of the animation</param>
+/// <param name="frameCount">The number of frames in the animation</param>
+/// <param name="framesPerSecond">The playback rate</param>
+/// <param name="size">The size of the drawn image, 0 uses the size of the frame</param>
+RLIMGUIAPI void rlImGuiSpriteAnimated(const rlImGuiSpriteSheet* sheet, int firstFrame, int frameCount, float framesPerSecond, Vector2 size);
+
+// Image atlas API
+// Every texture drawn by ImGui ends its draw command, so hundreds of small images are hundreds of draw calls.
+// Images added to the image atlas are copied into shared pages (textures on the GPU, images from a CPU copy),
+// and images from the same page that are drawn one after another are one draw call.
+// Pages are filled and repacked in rlImGuiEnd after ImGui has drawn, an image drawn before it is in a page is drawn from its own texture.
+// A render texture and the 2D or 3D mode matrices that are active when rlImGuiEnd is called are active again when it returns.
+// Images not drawn for the cold frames are evicted when the pages are full. rlImGuiShutdown removes every atlas image.
+
+typedef struct rlImGuiAtlasImage rlImGuiAtlasImage;
+
+typedef struct rlImGuiImageAtlasStats
+{
+    int Pages;                      // atlas pages, each a render texture
+    int PageSize;                   // width and height of a page
+    int Images;                     // images added to the atlas
+    int ImagesInPages;              // images that are in a page, the rest are drawn from their own texture
+    long long UsedPixels;           // page pixels used by images
+    float Occupancy;                // UsedPixels over the pixels of every page, 0 to 1
+    int AtlasDraws;                 // images drawn from a page last frame
+    int DirectDraws;                // images drawn from their own texture last frame
+    unsigned int GpuCopies;         // textures copied into a page since startup
+    unsigned int Uploads;           // images uploaded into a page since startup
+    unsigned int Evictions;         // images taken out of a page because they were not drawn
+    unsigned int Repacks;           // times the pages were packed again
+} rlImGuiImageAtlasStats;
+
+/// <summary>
+/// Sets the size and number of atlas pages and when images are cold.
+/// Images larger than half a page are always drawn from their own texture.
+/// </summary>
+/// <param name="pageSize">Width and height of a page, only changes while there are no pages (1024 by default), 0 keeps the current value</param>
+/// <param name="maxPages">The most pages to make (4 by default), 0 keeps the current value</param>
+/// <param name="coldFrames">Frames an image must go undrawn before it can be evicted (600 by default), 0 keeps the current value</param>
+RLIMGUIAPI void rlImGuiSetImageAtlasLimits(int pageSize, int maxPages, int coldFrames);
+
+/// <summary>
+/// Adds a texture to the image atlas, it is copied into a page on the GPU.
+/// The texture is still owned by the caller and must stay loaded until it is removed, it is used to draw and copy the image again after eviction.
+/// </summary>
+/// <param name="texture">The texture to add</param>
+/// <returns>The atlas image, or NULL if the texture is not valid</returns>
+RLIMGUIAPI rlImGuiAtlasImage* rlImGuiAtlasAddTexture(const Texture* texture);
+
+/// <summary>
+/// Adds an image to the image atlas, a copy of the pixels is kept and uploaded into a page.
+/// The image can be unloaded after this call.
+/// </summary>
+/// <param name="image">The image to add</param>
+/// <returns>The atlas image, or NULL if the image is not valid</returns>
+RLIMGUIAPI rlImGuiAtlasImage* rlImGuiAtlasAddImage(const Image* image);
+
+/// <summary>
+/// Removes an image from the atlas, its space is reused when the pages are repacked
+/// </summary>
+/// <param name="image">The atlas image to remove</param>
+RLIMGUIAPI void rlImGuiAtlasRemove(rlImGuiAtlasImage* image);
+
+/// <summary>
+/// Draws an atlas image in an ImGui Context at its full size
+/// </summary>
+/// <param name="image">The atlas image to draw</param>
+RLIMGUIAPI void rlImGuiImageFromAtlas(rlImGuiAtlasImage* image);
+
+/// <summary>
+/// Draws an atlas image in an ImGui Context at a specific size
+/// </summary>
+/// <param name="image">The atlas image to draw</param>
+/// <param name="size">The size of the drawn image</param>
+RLIMGUIAPI void rlImGuiImageFromAtlasSize(rlImGuiAtlasImage* image, Vector2 size);
+
+/// <summary>
+/// Draws an atlas image as an image button in an ImGui context
+/// </summary>
+/// <param name="name">The display name and ImGui ID for the button</param>
+/// <param name="image">The atlas image to draw</param>
+/// <param name="size">The size of the button</param>
+/// <returns>True if the button was clicked</returns>
+RLIMGUIAPI bool rlImGuiImageButtonFromAtlas(const char* name, rlImGuiAtlasImage* image, Vector2 size);
+
+/// <summary>
+/// Evicts the cold images and packs the pages again at the start of the next frame, to get back the space of removed images
+/// </summary>
+RLIMGUIAPI void rlImGuiCompactImageAtlas(void);
+
+/// <summary>
+/// Gets the state of the image atlas
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetImageAtlasStats(rlImGuiImageAtlasStats* stats);
+
+// Render texture pool API
+// Render textures for views that change size. Textures are made in sizes rounded up to the bucket size, a released texture
+// is kept and given to the next request it fits, and textures not used for the keep frames are unloaded at the end of a frame.
+// A pooled texture can be bigger than what was asked for, it is drawn into and shown from the bottom left part that was asked for.
+// rlImGuiImageRenderTexture and rlImGuiImageRenderTextureFit only show that part of a pooled texture. Viewports use the pool.
+
+typedef struct rlImGuiRenderTexturePoolStats
+{
+    int Textures;                   // render textures in the pool
+    int TexturesInUse;              // textures acquired and not released
+    long long TextureBytes;         // GPU memory of every texture in the pool, color and depth buffers
+    long long BytesInUse;           // GPU memory of the textures in use
+    unsigned int Loads;             // textures loaded since startup
+    unsigned int Reuses;            // requests given a texture that was already loaded
+    unsigned int Unloads;           // textures unloaded because they were not used
+} rlImGuiRenderTexturePoolStats;
+
+/// <summary>
+/// Sets how the pool rounds texture sizes and when it frees them
+/// </summary>
+/// <param name="bucketSize">Texture sizes are rounded up to a multiple of this (128 by default), 0 keeps the current value</param>
+/// <param name="keepFrames">Frames a released texture is kept for reuse (120 by default), 0 keeps the current value</param>
+/// <param name="settleFrames">Frames a viewport must keep its size before its texture is made to fit it (15 by default), 0 keeps the current value</param>
+RLIMGUIAPI void rlImGuiSetRenderTexturePoolLimits(int bucketSize, int keepFrames, int settleFrames);
+
+/// <summary>
+/// Gets a render texture at least the size asked for from the pool
+/// </summary>
+/// <param name="width">The width to draw</param>
+/// <param name="height">The height to draw</param>
+/// <returns>The render texture, or NULL if the size is not valid</returns>
+RLIMGUIAPI const RenderTexture* rlImGuiAcquireRenderTexture(int width, int height);
+
+/// <summary>
+/// Gives a render texture back to the pool, it must not be used after this
+/// </summary>
+/// <param name="texture">A texture from rlImGuiAcquireRenderTexture</param>
+RLIMGUIAPI void rlImGuiReleaseRenderTexture(const RenderTexture* texture);
+
+/// <summary>
+/// Starts drawing into the part of a pooled render texture that was asked for, with a 2D projection of that size. End it with EndTextureMode.
+/// </summary>
+/// <param name="texture">A texture from rlImGuiAcquireRenderTexture</param>
+/// <returns>True if the texture is from the pool and drawing started</returns>
+RLIMGUIAPI bool rlImGuiBeginRenderTextureMode(const RenderTexture* texture);
+
+/// <summary>
+/// Unloads every pooled texture that is not in use
+/// </summary>
+RLIMGUIAPI void rlImGuiTrimRenderTexturePool(void);
+
+/// <summary>
+/// Gets the textures in the pool and the GPU memory they hold
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetRenderTexturePoolStats(rlImGuiRenderTexturePoolStats* stats);
+
+// Viewport API
+// A viewport is an ImGui item that shows a render texture sized to it, for game and scene views inside a window.
+// It knows if it was visible last frame and its size in pixels, so the code that renders it can skip views that are
+// collapsed, in a hidden dock tab, closed or scrolled out of sight, and render at the size the view is shown at.
+// A view covered by another window still counts as visible. rlImGuiShutdown destroys the viewports left.
+// Textures come from the render texture pool. While a view is being resized it draws into part of a bigger texture,
+// and the texture is made to fit once the size settles. Use rlImGuiBeginViewportMode3D so the 3D aspect matches the view.
+// With dynamic resolution a view draws at a lower resolution when the frame time is over budget, and is still shown at full size.
+//
+// each frame:
+//   if (rlImGuiBeginViewportTexture(view)) { ... draw the scene ... rlImGuiEndViewportTexture(view); }
+//   inside an ImGui window: rlImGuiViewportImage(view, Vector2{ 0, 0 });
+
+typedef struct rlImGuiViewport rlImGuiViewport;
+
+typedef struct rlImGuiViewportStats
+{
+    int Viewports;                  // viewports that exist
+    int VisibleViewports;           // viewports that were visible last frame
+    int Textures;                   // viewports that hold a render texture
+    long long TextureBytes;         // GPU memory of those textures, color and depth buffers
+    unsigned int Renders;           // times rlImGuiBeginViewportTexture returned true since startup
+    unsigned int SkippedRenders;    // times it returned false because the viewport was not visible
+} rlImGuiViewportStats;
+
+/// <summary>
+/// Creates a viewport, it has no render texture until it is first shown
+/// </summary>
+/// <returns>The new viewport</returns>
+RLIMGUIAPI rlImGuiViewport* rlImGuiCreateViewport(void);
+
+/// <summary>
+/// Destroys a viewport and its render texture
+/// </summary>
+/// <param name="viewport">The viewport to destroy</param>
+RLIMGUIAPI void rlImGuiDestroyViewport(rlImGuiViewport* viewport);
+
+/// <summary>
+/// Sets how many frames a viewport can be hidden before its render texture is given back to the pool
+/// </summary>
+/// <param name="viewport">The viewport to change</param>
+/// <param name="frames">Frames to keep the texture (120 by default), 0 keeps it while the viewport exists</param>
+RLIMGUIAPI void rlImGuiSetViewportReleaseFrames(rlImGuiViewport* viewport, int frames);
+
+/// <summary>
+/// Shows the viewport's render texture at the current ImGui cursor position and notes its size and visibility
+/// </summary>
+/// <param name="viewport">The viewport to show</param>
+/// <param name="size">The size of the viewport, a size of 0 on an axis fills the content area on that axis</param>
+/// <returns>True if the viewport is visible</returns>
+RLIMGUIAPI bool rlImGuiViewportImage(rlImGuiViewport* viewport, Vector2 size);
+
+/// <summary>
+/// Checks if the viewport was visible in the last finished frame of its context, or in the one before the current frame while a frame is being built
+/// </summary>
+/// <param name="viewport">The viewport to check</param>
+/// <returns>True if the viewport was shown and not clipped</returns>
+RLIMGUIAPI bool rlImGuiIsViewportVisible(const rlImGuiViewport* viewport);
+
+/// <summary>
+/// Gets the size of the viewport in pixels the last time it was visible, including the high DPI scale
+/// </summary>
+/// <param name="viewport">The viewport to check</param>
+/// <returns>The size in pixels</returns>
+RLIMGUIAPI Vector2 rlImGuiGetViewportPixelSize(const rlImGuiViewport* viewport);
+
+/// <summary>
+/// Gets the rectangle the viewport was drawn in the last time it was visible, in ImGui screen coordinates
+/// </summary>
+/// <param name="viewport">The viewport to check</param>
+/// <returns>The screen rectangle of the viewport</returns>
+RLIMGUIAPI Rectangle rlImGuiGetViewportScreenRect(const rlImGuiViewport* viewport);
+
+/// <summary>
+/// Starts drawing into the viewport's render texture if the viewport was visible, with a 2D projection of its pixel size.
+/// Only draw and call rlImGuiEndViewportTexture if this returns true.
+/// </summary>
+/// <param name="viewport">The viewport to draw</param>
+/// <returns>True if the viewport should be drawn</returns>
+RLIMGUIAPI bool rlImGuiBeginViewportTexture(rlImGuiViewport* viewport);
+
+/// <summary>
+/// Ends drawing into the viewport's render texture
+/// </summary>
+/// <param name="viewport">The viewport that was drawn</param>
+RLIMGUIAPI void rlImGuiEndViewportTexture(rlImGuiViewport* viewport);
+
+/// <summary>
+/// Starts 3D mode with the aspect of the viewport, use it instead of BeginMode3D between rlImGuiBeginViewportTexture and rlImGuiEndViewportTexture.
+/// End it with EndMode3D.
+/// </summary>
+/// <param name="viewport">The viewport being drawn</param>
+/// <param name="camera">The camera to draw with</param>
+RLIMGUIAPI void rlImGuiBeginViewportMode3D(const rlImGuiViewport* viewport, Camera3D camera);
+
+/// <summary>
+/// Turns on dynamic resolution for a viewport. While the frame time is over the target the view is drawn at a lower resolution,
+/// and after a while well under the target it goes back up. The frame time is GetFrameTime, so with VSync on use a target above the refresh interval.
+/// </summary>
+/// <param name="viewport">The viewport to change</param>
+/// <param name="targetFrameMs">The frame time to stay under in milliseconds, 0 turns dynamic resolution off</param>
+/// <param name="minScale">The lowest scale of the pixel size, 0.1 to 1</param>
+/// <param name="maxScale">The highest scale of the pixel size, minScale to 1</param>
+RLIMGUIAPI void rlImGuiSetViewportDynamicResolution(rlImGuiViewport* viewport, float targetFrameMs, float minScale, float maxScale);
+
+/// <summary>
+/// Gets the scale the viewport is drawn at
+/// </summary>
+/// <param name="viewport">The viewport</param>
+/// <returns>The scale of the pixel size, 1 when dynamic resolution is off</returns>
+RLIMGUIAPI float rlImGuiGetViewportResolutionScale(const rlImGuiViewport* viewport);
+
+/// <summary>
+/// Gets the size the viewport is drawn at in pixels, the pixel size times the scale.
+/// The 2D projection set by rlImGuiBeginViewportTexture is the pixel size, so 2D drawing does not need this.
+/// </summary>
+/// <param name="viewport">The viewport</param>
+/// <returns>The size of the drawn part of the texture</returns>
+RLIMGUIAPI Vector2 rlImGuiGetViewportRenderSize(const rlImGuiViewport* viewport);
+
+/// <summary>
+/// Gets the frame times in milliseconds of the last frames the viewport was drawn in, as a ring buffer for ImGui::PlotLines
+/// </summary>
+/// <param name="viewport">The viewport</param>
+/// <param name="count">Set to the number of times in the buffer, can be NULL</param>
+/// <param name="offset">Set to the index of the oldest time, can be NULL</param>
+/// <returns>The frame times</returns>
+RLIMGUIAPI const float* rlImGuiGetViewportFrameTimes(const rlImGuiViewport* viewport, int* count, int* offset);
+
+/// <summary>
+/// Gets the viewport's render texture, it can be bigger than the viewport while the viewport is being resized
+/// </summary>
+/// <param name="viewport">The viewport</param>
+/// <returns>The pooled render texture, or NULL if the viewport has none</returns>
+RLIMGUIAPI const RenderTexture* rlImGuiGetViewportTexture(const rlImGuiViewport* viewport);
+
+/// <summary>
+/// Gets the number of viewports, how many were visible and the memory of their textures
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetViewportStats(rlImGuiViewportStats* stats);
+
+// Scene API
+// A scene is drawn by a callback straight into the window, in the place of an ImGui item, instead of into a render texture.
+// The callback runs while ImGui is rendered, so windows in front of the scene cover it and it needs no texture or copy.
+// The GL viewport is set to the item and the scissor to the part of it that is not clipped, (0,0) is the top left of
+// the item and a 2D projection of the item size is set. Clear it with ClearBackground, only the item is cleared.
+// Use rlImGuiBeginSceneMode3D instead of BeginMode3D so the 3D aspect matches the item. Do not call BeginTextureMode,
+// BeginScissorMode or EndDrawing in the callback. The scene is drawn each time ImGui is rendered, also when nothing changed,
+// so for scenes that are costly to draw and do not change each frame a viewport can be faster.
+
+typedef void (*rlImGuiSceneCallback)(Vector2 size, void* userData);
+
+typedef struct rlImGuiSceneStats
+{
+    int Scenes;                     // scene callbacks run in the last rendered frame
+    float DrawMs;                   // CPU time spent in them, including the batch flushes around them
+} rlImGuiSceneStats;
+
+/// <summary>
+/// Adds an item that draws a scene with a callback when ImGui is rendered
+/// </summary>
+/// <param name="size">The size of the item, a value of 0 uses the space left in the window</param>
+/// <param name="draw">The function that draws the scene, it is called with the item size</param>
+/// <param name="userData">Passed to the draw function, it must still be valid when rlImGuiEnd is called</param>
+/// <returns>True if the item is visible and the scene will be drawn</returns>
+RLIMGUIAPI bool rlImGuiScene(Vector2 size, rlImGuiSceneCallback draw, void* userData);
+
+/// <summary>
+/// Starts 3D mode with the aspect of the scene being drawn, use it instead of BeginMode3D in a scene callback
+/// </summary>
+/// <param name="camera">The camera to use</param>
+RLIMGUIAPI void rlImGuiBeginSceneMode3D(Camera3D camera);
+
+/// <summary>
+/// Gets how many scenes were drawn in the last rendered frame and how long they took
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetSceneStats(rlImGuiSceneStats* stats);
+
+// Large image API
+// A large image is shown from tiles of a mip pyramid, for images that are too big for one texture, such as maps or scans.
+// Only the tiles in view are loaded, at the level that matches the zoom, and tiles are loaded on worker threads so panning
+// and zooming never wait for them. Until a tile is loaded the closest coarser tile that is loaded is drawn in its place.
+// Tile textures are kept in a cache that unloads the tiles drawn longest ago when it is over a memory budget.
+// Tiles come from a loader function, or from a tiled file written by rlImGuiExportLargeImage.
+// rlImGuiShutdown destroys the large images left.
+//
+// inside an ImGui window: rlImGuiLargeImageView(image, Vector2{ 0, 0 });
+
+typedef struct rlImGuiLargeImage rlImGuiLargeImage;
+
+// Fills the RGBA8 pixels of a tile, x and y are the top left pixel of the tile in the level, where level 0 is the full
+// image and every level is half the size of the one under it. Called on worker threads, and for more than one tile at once.
+// Returns false if the tile could not be loaded.
+typedef bool (*rlImGuiLargeImageLoader)(int level, int x, int y, int width, int height, unsigned char* pixels, void* userData);
+
+typedef struct rlImGuiLargeImageStats
+{
+    int Images;                     // large images that exist
+    int Tiles;                      // tile textures loaded
+    long long TileBytes;            // GPU memory of the tile textures
+    long long BudgetBytes;          // the memory the tile cache is kept under
+    int PendingTiles;               // tiles waiting for a worker, being loaded or waiting to be uploaded
+    int TilesDrawn;                 // tiles drawn last frame
+    int FallbackTiles;              // of those, tiles drawn from a coarser level because theirs was not loaded yet
+    unsigned int Loads;             // tiles loaded since startup
+    unsigned int Evictions;         // tile textures unloaded to stay under the budget since startup
+    unsigned int Cancels;           // tiles that left the view before a worker got to them since startup
+    float AverageLoadMs;            // worker time to load a tile, over all the tiles loaded
+} rlImGuiLargeImageStats;
+
+/// <summary>
+/// Creates a large image that gets its tiles from a loader function
+/// </summary>
+/// <param name="width">The width of the full image</param>
+/// <param name="height">The height of the full image</param>
+/// <param name="loader">The function that fills the pixels of a tile, called on worker threads</param>
+/// <param name="userData">Passed to the loader, it must be valid until the image is destroyed</param>
+/// <returns>The new large image, or NULL if the size or loader is not valid</returns>
+RLIMGUIAPI rlImGuiLargeImage* rlImGuiCreateLargeImage(int width, int height, rlImGuiLargeImageLoader loader, void* userData);
+
+/// <summary>
+/// Opens a tiled file written by rlImGuiExportLargeImage, tiles are read from the file when they are needed
+/// </summary>
+/// <param name="fileName">The tiled file</param>
+/// <returns>The new large image, or NULL if the file could not be read</returns>
+RLIMGUIAPI rlImGuiLargeImage* rlImGuiLoadLargeImage(const char* fileName);
+
+/// <summary>
+/// Writes a tiled file with every level of an image, the loader is only asked for level 0 and the other levels are made from it.
+/// The loader is called on this thread, and only one tile for each level is held in memory at a time.
+/// </summary>
+/// <param name="fileName">The file to write</param>
+/// <param name="width">The width of the full image</param>
+/// <param name="height">The height of the full image</param>
+/// <param name="loader">The function that fills the pixels of a level 0 tile</param>
+/// <param name="userData">Passed to the loader</param>
+/// <returns>True if the file was written</returns>
+RLIMGUIAPI bool rlImGuiExportLargeImage(const char* fileName, int width, int height, rlImGuiLargeImageLoader loader, void* userData);
+
+/// <summary>
+/// Destroys a large image and unloads its tiles, it waits for a worker that is loading one of its tiles
+/// </summary>
+/// <param name="image">The large image to destroy</param>
+RLIMGUIAPI void rlImGuiDestroyLargeImage(rlImGuiLargeImage* image);
+
+/// <summary>
+/// Shows a large image as an item, drag to pan, the mouse wheel zooms and a double click fits the whole image
+/// </summary>
+/// <param name="image">The large image</param>
+/// <param name="size">The size of the item, a value of 0 uses the space left in the window</param>
+/// <returns>True if the item is visible</returns>
+RLIMGUIAPI bool rlImGuiLargeImageView(rlImGuiLargeImage* image, Vector2 size);
+
+/// <summary>
+/// Moves the view of a large image at once
+/// </summary>
+/// <param name="image">The large image</param>
+/// <param name="center">The image pixel at the center of the view</param>
+/// <param name="zoom">Screen pixels for each image pixel, 0 fits the whole image the next time it is shown</param>
+RLIMGUIAPI void rlImGuiSetLargeImageView(rlImGuiLargeImage* image, Vector2 center, float zoom);
+
+/// <summary>
+/// Gets the view of a large image
+/// </summary>
+/// <param name="image">The large image</param>
+/// <param name="center">Set to the image pixel at the center of the view, can be NULL</param>
+/// <param name="zoom">Set to the screen pixels for each image pixel, can be NULL</param>
+RLIMGUIAPI void rlImGuiGetLargeImageView(const rlImGuiLargeImage* image, Vector2* center, float* zoom);
+
+/// <summary>
+/// Gets the size of the full image
+/// </summary>
+/// <param name="image">The large image</param>
+/// <returns>The size in pixels</returns>
+RLIMGUIAPI Vector2 rlImGuiGetLargeImageSize(const rlImGuiLargeImage* image);
+
+/// <summary>
+/// Sets the GPU memory the tile cache is kept under and how many tiles are uploaded each frame, the defaults are 256 MB and 8.
+/// A value of 0 keeps the current setting.
+/// </summary>
+/// <param name="budgetBytes">The memory budget for the tile textures of all large images</param>
+/// <param name="uploadsPerFrame">The most tiles uploaded in one frame</param>
+RLIMGUIAPI void rlImGuiSetLargeImageLimits(long long budgetBytes, int uploadsPerFrame);
+
+/// <summary>
+/// Gets the tiles in the cache, the tiles drawn last frame and the loads since startup
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetLargeImageStats(rlImGuiLargeImageStats* stats);
+
+// Streaming texture API
+// A streaming texture shows frames made on other threads, such as camera feeds or generated images, without blocking
+// the producer or the main thread. Producers push frames from any thread, and the image always shows the newest frame that
+// was finished. Frames that are replaced by a newer one before they are shown are dropped.
+// Frames are uploaded to a ring of textures, so a frame is never uploaded to a texture the GPU may still be drawing from.
+// Stop the producers before destroying a streaming texture. rlImGuiShutdown destroys the streaming textures left.
+//
+// producer thread: rlImGuiPushStreamFrame(stream, pixels);
+//   or, to write the frame in place: void* frame = rlImGuiBeginStreamFrame(stream); if (frame) { ... rlImGuiEndStreamFrame(stream, frame); }
+// inside an ImGui window: rlImGuiStreamImage(stream, Vector2{ 0, 0 });
+
+typedef struct rlImGuiStreamTexture rlImGuiStreamTexture;
+
+typedef struct rlImGuiStreamTextureStats
+{
+    unsigned int Pushed;            // frames pushed by producers since the texture was made
+    unsigned int Uploaded;          // frames uploaded to a texture
+    unsigned int Dropped;           // frames replaced by a newer frame before they were uploaded
+    unsigned int Rejected;          // frames that could not be started because every buffer was in use
+    float PushedPerSecond;          // frames pushed over the last second
+    float UploadedPerSecond;        // frames uploaded over the last second
+    float UploadMegabytesPerSecond; // pixel data uploaded over the last second
+    float UploadMs;                 // CPU time of the last upload
+    float LatencyMs;                // time from the last uploaded frame being pushed to it being uploaded
+    int Textures;                   // textures in the ring
+    long long TextureBytes;         // GPU memory of those textures
+} rlImGuiStreamTextureStats;
+
+/// <summary>
+/// Creates a streaming texture, with a ring of textures for the frames and the CPU buffers producers write to
+/// </summary>
+/// <param name="width">The width of the frames</param>
+/// <param name="height">The height of the frames</param>
+/// <param name="format">The raylib pixel format of the frames, 0 is RGBA8</param>
+/// <param name="textureCount">The number of textures in the ring, 0 uses 3</param>
+/// <returns>The new streaming texture, or NULL if the size is not valid</returns>
+RLIMGUIAPI rlImGuiStreamTexture* rlImGuiCreateStreamTexture(int width, int height, int format, int textureCount);
+
+/// <summary>
+/// Destroys a streaming texture, no producer may be using it
+/// </summary>
+/// <param name="stream">The streaming texture to destroy</param>
+RLIMGUIAPI void rlImGuiDestroyStreamTexture(rlImGuiStreamTexture* stream);
+
+/// <summary>
+/// Copies a frame into the streaming texture, can be called from any thread
+/// </summary>
+/// <param name="stream">The streaming texture</param>
+/// <param name="pixels">The pixels of the frame, in the format and size of the streaming texture</param>
+/// <returns>True if the frame was pushed, false if every buffer was in use</returns>
+RLIMGUIAPI bool rlImGuiPushStreamFrame(rlImGuiStreamTexture* stream, const void* pixels);
+
+/// <summary>
+/// Gets a buffer to write a frame into, can be called from any thread. Finish it with rlImGuiEndStreamFrame.
+/// </summary>
+/// <param name="stream">The streaming texture</param>
+/// <returns>The pixels of the frame to write, or NULL if every buffer is in use</returns>
+RLIMGUIAPI void* rlImGuiBeginStreamFrame(rlImGuiStreamTexture* stream);
+
+/// <summary>
+/// Pushes a frame written into a buffer from rlImGuiBeginStreamFrame
+/// </summary>
+/// <param name="stream">The streaming texture</param>
+/// <param name="pixels">The buffer from rlImGuiBeginStreamFrame</param>
+/// <returns>True if the frame was pushed</returns>
+RLIMGUIAPI bool rlImGuiEndStreamFrame(rlImGuiStreamTexture* stream, void* pixels);
+
+/// <summary>
+/// Uploads the newest frame if there is one that was not uploaded yet, and gets the texture with it. Main thread only.
+/// </summary>
+/// <param name="stream">The streaming texture</param>
+/// <returns>The texture with the newest frame, or NULL until the first frame is pushed</returns>
+RLIMGUIAPI const Texture* rlImGuiGetStreamTexture(rlImGuiStreamTexture* stream);
+
+/// <summary>
+/// Shows the newest frame of a streaming texture as an image, a hidden image does not upload frames
+/// </summary>
+/// <param name="stream">The streaming texture</param>
+/// <param name="size">The size of the image, a value of 0 keeps the aspect of the frames, both 0 fits the space left in the window</param>
+/// <returns>True if a frame was shown</returns>
+RLIMGUIAPI bool rlImGuiStreamImage(rlImGuiStreamTexture* stream, Vector2 size);
+
+/// <summary>
+/// Gets the frames pushed, uploaded and dropped and the rates over the last second
+/// </summary>
+/// <param name="stream">The streaming texture</param>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetStreamTextureStats(const rlImGuiStreamTexture* stream, rlImGuiStreamTextureStats* stats);
+
+// Extra context API
+// Extra ImGui contexts for UIs that run at their own rate or get their own input, such as debug overlays or in world screens.
+// Every extra context shares the font atlas of the default context made by rlImGuiSetup, so call rlImGuiSetup first.
+// The shared atlas and its textures are kept until the last context is destroyed, so contexts can be destroyed in any order, then rlImGui deletes the atlas.
+
+typedef struct rlImGuiContext rlImGuiContext;
+
+/// <summary>
+/// Creates an ImGui context that draws to the screen and gets input, the default context made by rlImGuiSetup must exist.
+/// Extra contexts do not save an ini file.
+/// </summary>
+/// <param name="darkTheme">when true(default) the dark theme is used, when false the light theme is used</param>
+/// <returns>The new context, or NULL if rlImGuiSetup was not called</returns>
+RLIMGUIAPI rlImGuiContext* rlImGuiCreateContext(bool darkTheme);
+
+/// <summary>
+/// Destroys an extra context, any contexts left are destroyed by rlImGuiShutdown
+/// </summary>
+/// <param name="context">The context to destroy</param>
+RLIMGUIAPI void rlImGuiDestroyContext(rlImGuiContext* context);
+
+/// <summary>
+/// Sets the render texture a context draws into, the texture is cleared each time the context ends a frame.
+/// The context is laid out to the size of the texture. The texture must stay loaded while it is used.
+/// </summary>
+/// <param name="context">The context to change</param>
+/// <param name="target">The render texture to draw into, or NULL to draw to the screen</param>
+RLIMGUIAPI void rlImGuiSetContextTarget(rlImGuiContext* context, const RenderTexture* target);
+
+/// <summary>
+/// Sets the input a context gets. A context without input never has the mouse over it and ignores the keyboard.
+/// When the GLFW callbacks are used (RLIMGUI_GLFW_EVENTS) only the default context reads them, extra contexts poll raylib.
+/// </summary>
+/// <param name="context">The context to change</param>
+/// <param name="enabled">True if the context gets input</param>
+/// <param name="screenRect">The screen rectangle the context's render texture is drawn in, used to map the mouse into the context. NULL to use screen coordinates</param>
+RLIMGUIAPI void rlImGuiSetContextInput(rlImGuiContext* context, bool enabled, const Rectangle* screenRect);
+
+/// <summary>
+/// Starts a new ImGui frame in an extra context, using the raylib frame time.
+/// Can be called between rlImGuiBegin and rlImGuiEnd, the image functions draw into the context until rlImGuiEndContext.
+/// Apps that never call rlImGuiBegin get the once a frame work of rlImGuiEnd (atlas pages, the render texture pool, large image tiles
+/// and stream textures) when a context begins outside of any frame for the second time since that work was last done.
+/// </summary>
+/// <param name="context">The context to start</param>
+RLIMGUIAPI void rlImGuiBeginContext(rlImGuiContext* context);
+
+/// <summary>
+/// Starts a new ImGui frame in an extra context with a specified delta time, use this for contexts that are not updated every frame.
+/// The context is sent the key and button changes and the text typed since it last started, in order, as long as another context reads raylib input in the frames it skips.
+/// </summary>
+/// <param name="context">The context to start</param>
+/// <param name="deltaTime">The time since the context last started a frame</param>
+RLIMGUIAPI void rlImGuiBeginContextDelta(rlImGuiContext* context, float deltaTime);
+
+/// <summary>
+/// Ends the frame of an extra context and draws it to the screen or it's render texture
+/// </summary>
+/// <param name="context">The context to end</param>
+RLIMGUIAPI void rlImGuiEndContext(rlImGuiContext* context);
+
+// World panel API
+// A world panel is an extra context that draws into a render texture shown on a quad in the 3d world.
+// The mouse comes from a ray against the quad, and a panel is only drawn again when it's input or content changes.
+// rlImGuiSetWorldPanelBudget limits how many panels are drawn each frame, the panels that waited longest go first.
+//
+// each frame:
+//   rlImGuiUpdateWorldPanels(GetScreenToWorldRay(GetMousePosition(), camera));
+//   if (rlImGuiBeginWorldPanel(panel)) { ... ImGui code ... rlImGuiEndWorldPanel(panel); }
+//   BeginMode3D(camera); rlImGuiDrawWorldPanel(panel, WHITE); EndMode3D();
+
+typedef struct rlImGuiWorldPanel rlImGuiWorldPanel;
+
+typedef struct rlImGuiWorldPanelStats
+{
+    int PanelCount;             // panels that exist
+    int ReadyCount;             // panels that wanted to draw in the last update
+    int ScheduledCount;         // panels allowed to draw in the last update
+    unsigned int RefreshCount;  // panel draws since startup
+} rlImGuiWorldPanelStats;
+
+/// <summary>
+/// Creates a world panel with it's own context and render texture, the panel starts as a 1x1 quad at the origin facing +Z
+/// </summary>
+/// <param name="width">The width of the render texture in pixels</param>
+/// <param name="height">The height of the render texture in pixels</param>
+/// <param name="darkTheme">when true(default) the dark theme is used, when false the light theme is used</param>
+/// <returns>The new panel, or NULL if rlImGuiSetup was not called</returns>
+RLIMGUIAPI rlImGuiWorldPanel* rlImGuiCreateWorldPanel(int width, int height, bool darkTheme);
+
+/// <summary>
+/// Destroys a world panel, it's context and it's render texture. Panels left are destroyed by rlImGuiShutdown
+/// </summary>
+/// <param name="panel">The panel to destroy</param>
+RLIMGUIAPI void rlImGuiDestroyWorldPanel(rlImGuiWorldPanel* panel);
+
+/// <summary>
+/// Places the panel in the world, the corners are in the order used by GetRayCollisionQuad
+/// </summary>
+RLIMGUIAPI void rlImGuiSetWorldPanelQuad(rlImGuiWorldPanel* panel, Vector3 topLeft, Vector3 bottomLeft, Vector3 bottomRight, Vector3 topRight);
+
+/// <summary>
+/// Sets the shortest time between two draws of the panel, 0 lets it draw every frame that it changes
+/// </summary>
+/// <param name="panel">The panel to change</param>
+/// <param name="seconds">The time between draws</param>
+RLIMGUIAPI void rlImGuiSetWorldPanelRefreshInterval(rlImGuiWorldPanel* panel, float seconds);
+
+/// <summary>
+/// Tells the panel that the data it shows has changed, so it is drawn again
+/// </summary>
+RLIMGUIAPI void rlImGuiMarkWorldPanelDirty(rlImGuiWorldPanel* panel);
+
+/// <summary>
+/// Sets the most panels that are drawn in one frame, 0 for no limit
+/// </summary>
+RLIMGUIAPI void rlImGuiSetWorldPanelBudget(int panelsPerFrame);
+
+/// <summary>
+/// Sends the mouse and keyboard to the panels and picks the panels to draw this frame. Call once per frame before any rlImGuiBeginWorldPanel.
+/// The closest panel hit by the ray gets the mouse, the last panel clicked gets the keys and text typed.
+/// While the default context wants the mouse, such as when a window is over the 3D view, no panel is hovered or picked.
+/// </summary>
+/// <param name="ray">The mouse ray, such as GetScreenToWorldRay(GetMousePosition(), camera)</param>
+RLIMGUIAPI void rlImGuiUpdateWorldPanels(Ray ray);
+
+/// <summary>
+/// Starts the ImGui frame of a panel if it was picked to draw this frame.
+/// Only call rlImGuiEndWorldPanel and the panel's ImGui code if this returns true
+/// </summary>
+/// <param name="panel">The panel to start</param>
+/// <returns>True if the panel is drawing this frame</returns>
+RLIMGUIAPI bool rlImGuiBeginWorldPanel(rlImGuiWorldPanel* panel);
+
+/// <summary>
+/// Ends the frame of a panel and draws it into it's render texture
+/// </summary>
+RLIMGUIAPI void rlImGuiEndWorldPanel(rlImGuiWorldPanel* panel);
+
+/// <summary>
+/// Draws the panel's quad, call inside BeginMode3D
+/// </summary>
+/// <param name="panel">The panel to draw</param>
+/// <param name="tint">The color to tint the panel with</param>
+RLIMGUIAPI void rlImGuiDrawWorldPanel(const rlImGuiWorldPanel* panel, Color tint);
+
+/// <summary>
+/// Returns true if the mouse ray hit this panel in the last rlImGuiUpdateWorldPanels, use it to keep the game from using the click
+/// </summary>
+RLIMGUIAPI bool rlImGuiIsWorldPanelHovered(const rlImGuiWorldPanel* panel);
+
+/// <summary>
+/// Gets the render texture of the panel, to draw it in a custom way
+/// </summary>
+RLIMGUIAPI Texture rlImGuiGetWorldPanelTexture(const rlImGuiWorldPanel* panel);
+
+/// <summary>
+/// Gets how many panels are drawing and waiting
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetWorldPanelStats(rlImGuiWorldPanelStats* stats);
+
+// Font atlas API
+// Every context made by rlImGui shares one font atlas owned by the backend, the fonts are loaded once and the atlas texture is uploaded once.
+// New glyphs are added to the shared texture and seen by every context.
+
+typedef struct rlImGuiFontAtlasStats
+{
+    int ContextCount;               // rlImGui contexts using the shared atlas
+    int AtlasWidth;                 // size of the current atlas texture
+    int AtlasHeight;
+    int TextureCount;               // GPU textures the backend has made for ImGui
+    long long TextureBytes;         // memory used by those textures
+    unsigned int TextureCreates;    // textures made since startup
+    unsigned int TextureUpdates;    // uploads of changed textures, such as new glyphs
+    unsigned int TextureDestroys;   // textures destroyed since startup
+    double FontSetupSeconds;        // time spent adding the default fonts to the atlas
+    long long TextureUploadBytes;   // bytes sent to the GPU by texture updates, only changed rects are sent
+    int PrewarmedGlyphs;            // glyphs baked ahead of use by rlImGuiPrewarmGlyphs or a glyph record
+    double PrewarmSeconds;          // time spent baking those glyphs
+} rlImGuiFontAtlasStats;
+
+/// <summary>
+/// Gets the state of the shared font atlas and the textures rlImGui has made for ImGui
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out, false while an async setup is building the fonts</returns>
+RLIMGUIAPI bool rlImGuiGetFontAtlasStats(rlImGuiFontAtlasStats* stats);
+
+typedef struct rlImGuiFontAtlasBudgetStats
+{
+    long long Budget;               // the budget in bytes, 0 when there is none
+    long long TextureBytes;         // size of the atlas texture, the GPU texture and the CPU copy are each this size
+    int BakedSizes;                 // font sizes in the atlas
+    int Glyphs;                     // glyphs in those sizes
+    long long GlyphPixels;          // atlas pixels used by the glyphs
+    float Occupancy;                // GlyphPixels over the atlas size, 0 to 1
+    unsigned int EvictedSizes;      // font sizes discarded since startup
+    unsigned int EvictedGlyphs;     // glyphs discarded with them
+    unsigned int Rebakes;           // times every size was discarded because the sizes in use were over budget
+    unsigned int Repacks;           // times the atlas was repacked into a new texture
+    double EvictSeconds;            // time spent evicting and repacking
+} rlImGuiFontAtlasBudgetStats;
+
+/// <summary>
+/// Sets a memory budget for the font atlas. At the start of a frame, when the atlas texture is bigger than the budget,
+/// the font sizes that have not been drawn for the longest time are discarded and the atlas is repacked into a smaller texture.
+/// When the sizes in use are still over the budget every size is discarded, and only the glyphs that are drawn again are baked.
+/// Sizes locked with ImFontFlags_LockBakedSizes, such as distance field fonts, are never discarded.
+/// </summary>
+/// <param name="bytes">The most bytes the atlas texture should use, 0 removes the budget</param>
+/// <param name="coldFrames">Frames a size must go unused before it is evicted, 0 keeps the current value (300 by default)</param>
+RLIMGUIAPI void rlImGuiSetFontAtlasBudget(long long bytes, int coldFrames);
+
+/// <summary>
+/// Discards every font size that can be baked again and repacks the atlas at the start of the next frame
+/// </summary>
+RLIMGUIAPI void rlImGuiCompactFontAtlas(void);
+
+/// <summary>
+/// Gets the atlas occupancy and what the budget has evicted
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out, false while an async setup is building the fonts</returns>
+RLIMGUIAPI bool rlImGuiGetFontAtlasBudgetStats(rlImGuiFontAtlasBudgetStats* stats);
+
+/// <summary>
+/// Queues glyphs to be baked into the font atlas at the start of the next frame.
+/// Glyphs, including the Font Awesome icons, are only baked the first time they are drawn at a size,
+/// so this avoids the atlas update in the middle of the frame that first shows them.
+/// </summary>
+/// <param name="text">UTF-8 text with the glyphs to bake, such as a string of ICON_FA_ macros</param>
+/// <param name="fontSize">The font size to bake them at, 0 for the current size</param>
+RLIMGUIAPI void rlImGuiPrewarmGlyphs(const char* text, float fontSize);
+
+/// <summary>
+/// Queues a range of codepoints to be baked into the font atlas at the start of the next frame
+/// </summary>
+/// <param name="first">The first codepoint</param>
+/// <param name="last">The last codepoint, included in the range</param>
+/// <param name="fontSize">The font size to bake them at, 0 for the current size</param>
+RLIMGUIAPI void rlImGuiPrewarmGlyphRange(unsigned int first, unsigned int last, float fontSize);
+
+/// <summary>
+/// Sets a file that records the glyphs (font, size and character) a session used, must be called before rlImGuiSetup or after rlImGuiShutdown.
+/// The glyphs in the file are baked during rlImGuiEndInitImGui, so text that was shown in an earlier session does not
+/// update the atlas the first time it shows. The glyphs used this session are written to the file in rlImGuiShutdown.
+/// </summary>
+/// <param name="fileName">The record file, NULL stops recording</param>
+/// <returns>True if the file will be used</returns>
+RLIMGUIAPI bool rlImGuiSetGlyphRecordFile(const char* fileName);
+
+/// <summary>
+/// Writes the glyphs used so far to the glyph record file
+/// </summary>
+/// <returns>True if the file was written</returns>
+RLIMGUIAPI bool rlImGuiSaveGlyphRecord(void);
+
+// Font cache API
+// An optional file that keeps the glyphs ImGui bakes into the font atlas, keyed by font data, font size, DPI scale and ImGui version.
+// On the next launch the glyphs are copied from the file instead of being rasterized again. The file is memory mapped where it can be.
+
+typedef struct rlImGuiFontCacheStats
+{
+    bool Enabled;                   // a cache file is in use
+    bool Mapped;                    // the cache file is memory mapped instead of read into memory
+    int FileGlyphs;                 // glyphs that were in the cache file
+    int NewGlyphs;                  // glyphs baked this run that were not in the file
+    unsigned int Hits;              // glyph loads served from the cache
+    unsigned int Misses;            // glyph loads that had to be rasterized
+    long long FileBytes;            // size of the cache file that was loaded
+    double LoadSeconds;             // time spent opening the cache file
+} rlImGuiFontCacheStats;
+
+/// <summary>
+/// Sets the file used to cache baked font glyphs, must be called before rlImGuiSetup.
+/// The cache is saved in rlImGuiShutdown and closed, so it must be set again before the next setup.
+/// </summary>
+/// <param name="fileName">The cache file, NULL disables the cache</param>
+/// <returns>True if an existing cache file was loaded</returns>
+RLIMGUIAPI bool rlImGuiSetFontCacheFile(const char* fileName);
+
+/// <summary>
+/// Writes the glyphs baked so far to the font cache file
+/// </summary>
+/// <returns>True if the file is up to date</returns>
+RLIMGUIAPI bool rlImGuiSaveFontCache(void);
+
+/// <summary>
+/// Gets how well the font cache is working
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetFontCacheStats(rlImGuiFontCacheStats* stats);
+
+// Distance field font API
+// An optional font mode where glyphs are baked once, at one reference size, as signed distance fields.
+// Text at every other size or zoom scales those glyphs and is drawn with a distance field shader, so the atlas does not grow when the size changes.
+// Needs OpenGL 2.1, 3.3, 4.3 or ES 2.0 and up, OpenGL 1.1 draws the raw distance field.
+
+/// <summary>
+/// Turns distance field fonts on or off, must be called before rlImGuiSetup
+/// </summary>
+/// <param name="enabled">Bake and draw fonts as distance fields</param>
+/// <param name="referenceSize">The one size glyphs are baked at, 0 keeps the current size (32 by default)</param>
+/// <returns>True if the mode was set</returns>
+RLIMGUIAPI bool rlImGuiSetSdfFonts(bool enabled, float referenceSize);
+
+/// <summary>
+/// Checks if distance field fonts are on
+/// </summary>
+/// <returns>True if fonts are baked and drawn as distance fields</returns>
+RLIMGUIAPI bool rlImGuiIsSdfFonts(void);
+
+// Input recording and replay API
+// Records everything the backend feeds to ImGui (keys, text, mouse, gamepad, focus, delta time and display size) as raylib automation events,
+// so that a session can be replayed frame by frame into a fresh context, for example as a repeatable benchmark input.
+
+/// <summary>
+/// Starts recording the input sent to ImGui, any previous recording is discarded
+/// </summary>
+RLIMGUIAPI void rlImGuiStartInputRecording(void);
+
+/// <summary>
+/// Stops recording input, the recording is kept until the next recording is started
+/// </summary>
+RLIMGUIAPI void rlImGuiStopInputRecording(void);
+
+/// <summary>
+/// Returns true while input is being recorded
+/// </summary>
+RLIMGUIAPI bool rlImGuiIsInputRecording(void);
+
+/// <summary>
+/// Saves the current input recording to a binary file
+/// </summary>
+/// <param name="fileName">The file to write</param>
+/// <returns>True if the file was written</returns>
+RLIMGUIAPI bool rlImGuiExportInputRecording(const char* fileName);
+
+/// <summary>
+/// Loads an input recording and replays it, one recorded frame each time input is processed.
+/// All live input is ignored during the replay, and the recorded delta time, display size and framebuffer scale are used for each frame.
+/// The replay stops on it's own after the number of frames that were recorded.
+/// </summary>
+/// <param name="fileName">The file written by rlImGuiExportInputRecording</param>
+/// <returns>True if the replay was started</returns>
+RLIMGUIAPI bool rlImGuiStartInputReplay(const char* fileName);
+
+/// <summary>
+/// Stops an input replay and returns to live input
+/// </summary>
+RLIMGUIAPI void rlImGuiStopInputReplay(void);
+
+/// <summary>
+/// Returns true while an input replay has frames left to send
+/// </summary>
+RLIMGUIAPI bool rlImGuiIsInputReplaying(void);
+
+// Input latency API
+// Each input event is timed when it was captured, when it was sent to ImGui, when ImGui::Render finished and when ImGui_ImplRaylib_RenderDrawData returned.
+// Polled input is captured by raylib when the previous frame ends, so that is used as it's capture time. Events from RLIMGUI_GLFW_EVENTS use the callback time.
+// The time taken by the swap and the display after rlImGuiEnd is not included.
+
+typedef struct rlImGuiInputLatencyStats
+{
+    // the last frame that had input, worst case over it's events
+    unsigned int FrameEventCount;
+    float FrameCaptureToSubmitMs;
+    float FrameSubmitToRenderMs;
+    float FrameRenderToDrawMs;
+    float FrameTotalMs;
+
+    // capture to draw latency of the most recent events
+    unsigned int SampleCount;
+    float P50Ms;
+    float P90Ms;
+    float P99Ms;
+    float MaxMs;
+} rlImGuiInputLatencyStats;
+
+/// <summary>
+/// Turns input latency tracking on or off, it is off by default.
+/// Works with rlImGuiStartInputReplay so latency can be measured with a recorded session.
+/// </summary>
+/// <param name="enabled">True to track latency</param>
+RLIMGUIAPI void rlImGuiSetInputLatencyTracking(bool enabled);
+
+/// <summary>
+/// Returns true if input latency is being tracked
+/// </summary>
+RLIMGUIAPI bool rlImGuiIsInputLatencyTracking(void);
+
+/// <summary>
+/// Clears the latency history
+/// </summary>
+RLIMGUIAPI void rlImGuiResetInputLatencyStats(void);
+
+/// <summary>
+/// Gets the latency of the last frame with input and the percentiles over the recent history
+/// </summary>
+/// <param name="stats">The stats to fill out</param>
+/// <returns>True if the stats were filled out</returns>
+RLIMGUIAPI bool rlImGuiGetInputLatencyStats(rlImGuiInputLatencyStats* stats);
+
+/// <summary>
+/// Shows a window with the input latency stats, call between rlImGuiBegin and rlImGuiEnd
+/// </summary>
+/// <param name="open">Optional pointer to a bool that is cleared when the window is closed</param>
+RLIMGUIAPI void rlImGuiShowInputLatencyOverlay(bool* open);
+
+// Late input API
+// rlImGuiBegin uses the input raylib polled at the end of the previous frame. These let the mouse position be read again as late as possible.
+// The cursor is read directly from GLFW when rlImGui is built with RLIMGUI_GLFW_EVENTS, otherwise raylib's last polled position is used and polling does nothing.
+
+/// <summary>
+/// Returns true if rlImGuiPollInput can read a newer mouse position than raylib's, only when built with RLIMGUI_GLFW_EVENTS
+/// </summary>
+RLIMGUIAPI bool rlImGuiCanPollInput(void);
+
+/// <summary>
+/// Reads the current mouse position, the next rlImGuiBegin will use it for hover and drag instead of the position raylib polled.
+/// Call this after the game update and just before rlImGuiBegin. Raylib's own input state is not changed.
+/// Does nothing when rlImGuiCanPollInput returns false.
+/// </summary>
+RLIMGUIAPI void rlImGuiPollInput(void);
+
+/// <summary>
+/// Hides the OS cursor and draws ImGui's software cursor in rlImGuiEnd, at the mouse position read at that time.
+/// Use this instead of io.MouseDrawCursor, that draws the cursor where the mouse was when the frame started.
+/// </summary>
+/// <param name="enabled">True to draw the late cursor</param>
+RLIMGUIAPI void rlImGuiSetLateSoftwareCursor(bool enabled);
+
+/// <summary>
+/// Returns true if the late software cursor is being drawn
+/// </summary>
+RLIMGUIAPI bool rlImGuiIsLateSoftwareCursor(void);
+
 #ifdef __cplusplus
 }
 #endif